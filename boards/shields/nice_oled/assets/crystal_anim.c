@@ -0,0 +1,278 @@
+/* Generated by scripts/encode_animation.py from scripts/animations/crystal.c, do not edit */
+/* 16 frames of 69x68, 3940 bytes instead of 9920 */
+
+#include "../widgets/delta_anim.h"
+
+static const uint8_t crystal_anim_stream[] = {
+    0x3f, 0x3f, 0x2d, 0x81, 0x07, 0x80, 0x06, 0x81, 0x1b, 0xe0, 0x06, 0x81, 0x61, 0x78, 0x05,
+    0x82, 0x01, 0x81, 0xfe, 0x05, 0x83, 0x06, 0x01, 0xfd, 0x80, 0x04, 0x83, 0x18, 0x01, 0xfa,
+    0xe0, 0x04, 0x83, 0x60, 0x01, 0xf0, 0x18, 0x03, 0x84, 0x01, 0x80, 0x01, 0xea, 0xae, 0x01,
+    0x90, 0x08, 0x00, 0x06, 0x00, 0x01, 0xc0, 0x01, 0x80, 0x00, 0x08, 0x00, 0x18, 0x00, 0x01,
+    0xaa, 0xaa, 0xe0, 0x02, 0x82, 0x60, 0x00, 0x01, 0x01, 0x80, 0x18, 0x01, 0x86, 0x01, 0x80,
+    0x00, 0xff, 0xfe, 0xaa, 0xae, 0x01, 0x8a, 0x06, 0x00, 0xff, 0x00, 0x03, 0xfc, 0x01, 0x80,
+    0x00, 0x18, 0x7f, 0x02, 0x85, 0x03, 0xfa, 0xe0, 0x00, 0x7f, 0x80, 0x03, 0x83, 0x07, 0xf8,
+    0x00, 0x60, 0x05, 0x82, 0x18, 0x00, 0x18, 0x05, 0x82, 0x60, 0x00, 0x06, 0x04, 0x84, 0x01,
+    0x80, 0x00, 0x01, 0x80, 0x03, 0x80, 0x06, 0x02, 0x80, 0x60, 0x03, 0x80, 0x18, 0x02, 0x80,
+    0x18, 0x03, 0x80, 0x60, 0x02, 0x80, 0x06, 0x02, 0x81, 0x01, 0x80, 0x02, 0x81, 0x01, 0x80,
+    0x01, 0x80, 0x06, 0x04, 0x80, 0x60, 0x01, 0x80, 0x18, 0x04, 0x80, 0x18, 0x01, 0x80, 0x60,
+    0x04, 0x83, 0x06, 0x00, 0x01, 0x80, 0x04, 0x82, 0x01, 0x80, 0x06, 0x06, 0x81, 0x60, 0x18,
+    0x06, 0x81, 0x18, 0x60, 0x06, 0x81, 0x07, 0x80, 0x3f, 0x03, 0x80, 0x40, 0x3f, 0x29, 0x3f,
+    0x3f, 0x24, 0x80, 0x0f, 0x07, 0x81, 0x31, 0x40, 0x06, 0x81, 0xd8, 0x90, 0x05, 0x82, 0x03,
+    0x63, 0x74, 0x05, 0x82, 0x0d, 0x80, 0xa9, 0x05, 0x83, 0x36, 0x01, 0xfd, 0x40, 0x04, 0x83,
+    0xd8, 0x00, 0xaf, 0x10, 0x03, 0x84, 0x01, 0x60, 0x01, 0xf3, 0xe0, 0x03, 0x84, 0x07, 0x80,
+    0x00, 0xbd, 0x50, 0x01, 0x86, 0x08, 0x00, 0x1e, 0x00, 0x01, 0xcf, 0xfe, 0x01, 0x87, 0x08,
+    0x00, 0x78, 0x00, 0x7e, 0x55, 0x57, 0x80, 0x01, 0x85, 0x01, 0xe0, 0x0f, 0x81, 0x1f, 0xf8,
+    0x01, 0x94, 0x08, 0x07, 0x81, 0xf0, 0xff, 0xfe, 0x57, 0xf8, 0x00, 0x08, 0x1e, 0x3e, 0xff,
+    0x00, 0x03, 0xfb, 0xc0, 0x00, 0x18, 0x7f, 0xbf, 0x02, 0x85, 0x03, 0xc4, 0x80, 0x10, 0x87,
+    0x80, 0x03, 0x83, 0x06, 0x08, 0x10, 0x90, 0x05, 0x82, 0xe8, 0x00, 0x64, 0x04, 0x83, 0x03,
+    0x80, 0x00, 0x19, 0x04, 0x80, 0x0e, 0x01, 0x81, 0x06, 0x40, 0x03, 0x80, 0x38, 0x01, 0x81,
+    0x01, 0x90, 0x03, 0x80, 0xe0, 0x02, 0x80, 0x64, 0x02, 0x81, 0x03, 0x80, 0x02, 0x80, 0x19,
+    0x02, 0x80, 0x0c, 0x03, 0x81, 0x06, 0x40, 0x01, 0x80, 0x30, 0x03, 0x81, 0x01, 0x90, 0x01,
+    0x80, 0xd0, 0x04, 0x83, 0xe4, 0x00, 0x03, 0x50, 0x04, 0x83, 0x39, 0x00, 0x0d, 0x40, 0x04,
+    0x82, 0x0e, 0x40, 0x35, 0x05, 0x82, 0x03, 0x90, 0xd4, 0x06, 0x81, 0xe7, 0x50, 0x06, 0x81,
+    0x3b, 0x40, 0x06, 0x80, 0x0f, 0x3b, 0x80, 0x40, 0x07, 0x80, 0x80, 0x3f, 0x20, 0x3f, 0x3f,
+    0x1b, 0x80, 0x06, 0x07, 0x81, 0x14, 0x80, 0x06, 0x81, 0x54, 0x20, 0x05, 0x82, 0x01, 0x42,
+    0x28, 0x05, 0x82, 0x01, 0x00, 0xa0, 0x0f, 0x81, 0x02, 0xaa, 0x08, 0x80, 0x80, 0x05, 0x82,
+    0x02, 0xa9, 0x50, 0x05, 0x82, 0x1e, 0x82, 0xa8, 0x04, 0x83, 0x01, 0xe0, 0x75, 0x54, 0x04,
+    0x84, 0x1e, 0x7f, 0xf8, 0x2a, 0x80, 0x01, 0x8b, 0x01, 0x01, 0xef, 0x80, 0x1f, 0x87, 0xe8,
+    0x00, 0x08, 0x05, 0x0f, 0xf0, 0x01, 0x85, 0xfa, 0xaa, 0x00, 0x08, 0x04, 0xce, 0x02, 0x85,
+    0x07, 0x3e, 0x00, 0x18, 0x18, 0xc0, 0x03, 0x83, 0x31, 0x80, 0x10, 0x08, 0x04, 0x82, 0x01,
+    0x00, 0x10, 0x10, 0x82, 0x20, 0x00, 0x80, 0x03, 0x84, 0x10, 0x00, 0x60, 0x04, 0x20, 0x03,
+    0x84, 0x42, 0x01, 0xc8, 0x01, 0x2c, 0x02, 0x85, 0x03, 0x48, 0x07, 0x08, 0x00, 0x17, 0x02,
+    0x86, 0x0f, 0x80, 0x10, 0x10, 0x00, 0x02, 0xc0, 0x01, 0x82, 0x3c, 0x00, 0x0c, 0x01, 0x84,
+    0x01, 0x78, 0x00, 0x01, 0xf0, 0x04, 0x83, 0xa6, 0x00, 0x06, 0xc0, 0x04, 0x82, 0x17, 0xc0,
+    0x3b, 0x05, 0x82, 0x0a, 0x70, 0xcc, 0x05, 0x82, 0x01, 0x6f, 0x30, 0x06, 0x81, 0xac, 0xc8,
+    0x05, 0x82, 0x01, 0x43, 0x28, 0x06, 0x81, 0x40, 0xa0, 0x06, 0x81, 0x12, 0x80, 0x06, 0x80,
+    0x06, 0x3b, 0x80, 0x80, 0x06, 0x80, 0x01, 0x3f, 0x18, 0x3f, 0x3f, 0x12, 0x80, 0x0f, 0x07,
+    0x81, 0x34, 0xc0, 0x06, 0x81, 0x5a, 0xe0, 0x05, 0x82, 0x01, 0xe0, 0x58, 0x05, 0x82, 0x07,
+    0x80, 0x0e, 0x05, 0x82, 0x0a, 0x00, 0x07, 0x05, 0x83, 0x3c, 0x00, 0x02, 0xc0, 0x04, 0x80,
+    0xf0, 0x01, 0x80, 0x70, 0x03, 0x84, 0x01, 0xc0, 0x0e, 0x00, 0x28, 0x03, 0x84, 0x07, 0x00,
+    0x72, 0x40, 0x06, 0x03, 0x85, 0x1e, 0x03, 0x9f, 0xc8, 0x03, 0x80, 0x02, 0x85, 0x38, 0x1d,
+    0xe0, 0x79, 0x01, 0x40, 0x02, 0x85, 0xa0, 0xfe, 0x00, 0x07, 0xa2, 0x90, 0x01, 0x82, 0x03,
+    0x86, 0xe0, 0x01, 0x81, 0x71, 0x5c, 0x01, 0x81, 0x07, 0x36, 0x02, 0x81, 0x06, 0x2a, 0x01,
+    0x81, 0x05, 0x30, 0x03, 0x80, 0xc4, 0x01, 0x80, 0x11, 0x04, 0x80, 0x08, 0x13, 0x80, 0x12,
+    0x04, 0x84, 0x04, 0x80, 0x20, 0x06, 0x40, 0x03, 0x84, 0x26, 0x40, 0x60, 0x05, 0x58, 0x02,
+    0x85, 0x01, 0xba, 0x61, 0xc8, 0x03, 0xdb, 0x02, 0x86, 0x0d, 0xac, 0x1f, 0x08, 0x00, 0x81,
+    0xe0, 0x01, 0x9d, 0x7c, 0x50, 0x10, 0x10, 0x00, 0x3d, 0xdc, 0x00, 0x03, 0xb1, 0x40, 0x2c,
+    0x08, 0x00, 0x1c, 0x13, 0x80, 0x1d, 0xc7, 0x80, 0x20, 0x10, 0x00, 0x07, 0x51, 0xf0, 0xe6,
+    0x0e, 0x00, 0x10, 0x01, 0x84, 0x01, 0x44, 0x2f, 0x38, 0x38, 0x04, 0x83, 0xea, 0x80, 0xc0,
+    0xf0, 0x04, 0x83, 0x31, 0x47, 0x03, 0xc0, 0x04, 0x82, 0x0c, 0x9c, 0x05, 0x05, 0x82, 0x06,
+    0x14, 0x1e, 0x05, 0x82, 0x01, 0xfc, 0x78, 0x06, 0x81, 0x77, 0xa0, 0x06, 0x81, 0x35, 0xc0,
+    0x06, 0x80, 0x0f, 0x3a, 0x80, 0x01, 0x3f, 0x18, 0x3f, 0x3f, 0x12, 0x80, 0x09, 0x07, 0x81,
+    0x29, 0x40, 0x06, 0x81, 0x22, 0x80, 0x05, 0x82, 0x01, 0x21, 0x48, 0x05, 0x82, 0x05, 0x02,
+    0xaa, 0x05, 0x82, 0x04, 0x89, 0x54, 0x05, 0x83, 0x20, 0x1e, 0xaa, 0x40, 0x04, 0x83, 0xa2,
+    0x62, 0xd5, 0x50, 0x04, 0x83, 0x83, 0x8f, 0x4a, 0xa0, 0x03, 0x84, 0x04, 0x8c, 0x70, 0xe9,
+    0x52, 0x03, 0x85, 0x14, 0x73, 0x80, 0x1d, 0xaa, 0x90, 0x02, 0x85, 0x13, 0x9c, 0x00, 0x03,
+    0xb5, 0x10, 0x02, 0x81, 0x86, 0xe0, 0x01, 0x81, 0x72, 0x88, 0x01, 0x81, 0x02, 0xbf, 0x02,
+    0x81, 0x0f, 0x54, 0x01, 0x81, 0x02, 0xf8, 0x02, 0x81, 0x01, 0xe8, 0x01, 0x81, 0x06, 0xc0,
+    0x03, 0x80, 0x34, 0x01, 0x80, 0x16, 0x04, 0x80, 0x06, 0x01, 0x80, 0x10, 0x05, 0x80, 0x80,
+    0x09, 0x80, 0x11, 0x04, 0x84, 0x08, 0x80, 0x00, 0x01, 0x30, 0x03, 0x81, 0xc8, 0x40, 0x01,
+    0x80, 0x16, 0x02, 0x86, 0x06, 0xc0, 0x60, 0x00, 0x02, 0x98, 0xe0, 0x01, 0x82, 0x76, 0x04,
+    0x18, 0x01, 0x85, 0x95, 0x1e, 0x00, 0x07, 0xf0, 0x10, 0x02, 0x99, 0x1f, 0xed, 0xe0, 0x7b,
+    0x80, 0x00, 0x20, 0x08, 0x00, 0x15, 0x41, 0x3f, 0x9c, 0x02, 0x80, 0x20, 0x10, 0x00, 0x05,
+    0xc7, 0xf0, 0xe0, 0x02, 0x00, 0x50, 0x10, 0x01, 0x85, 0x05, 0x47, 0x00, 0x10, 0x00, 0x20,
+    0x02, 0x83, 0xbf, 0xf0, 0x00, 0x50, 0x04, 0x83, 0x25, 0x40, 0x00, 0x40, 0x04, 0x82, 0x03,
+    0xc2, 0x02, 0x05, 0x82, 0x04, 0x02, 0x0a, 0x05, 0x82, 0x01, 0x02, 0x08, 0x06, 0x81, 0x01,
+    0x40, 0x06, 0x81, 0x28, 0x40, 0x06, 0x80, 0x09, 0x3f, 0x3f, 0x14, 0x3f, 0x31, 0x80, 0x80,
+    0x07, 0x80, 0x40, 0x07, 0x80, 0x60, 0x07, 0x80, 0x20, 0x04, 0x80, 0x06, 0x01, 0x80, 0x30,
+    0x04, 0x83, 0x14, 0x80, 0x00, 0x30, 0x04, 0x83, 0x54, 0x20, 0x00, 0x10, 0x04, 0x80, 0x48,
+    0x01, 0x80, 0x10, 0x04, 0x80, 0x5c, 0x01, 0x80, 0x10, 0x03, 0x84, 0x0a, 0x6b, 0x81, 0x00,
+    0x10, 0x03, 0x84, 0x0d, 0x9f, 0xe0, 0x00, 0x10, 0x03, 0x84, 0x0c, 0x60, 0x78, 0x00, 0x10,
+    0x03, 0x84, 0x5b, 0x80, 0x1e, 0x00, 0x10, 0x03, 0x83, 0x6c, 0x00, 0x03, 0x80, 0x03, 0x81,
+    0x01, 0xf0, 0x01, 0x81, 0xe0, 0x10, 0x02, 0x81, 0x0d, 0x80, 0x01, 0x81, 0x18, 0x10, 0x02,
+    0x80, 0x9e, 0x02, 0x81, 0x06, 0x08, 0x02, 0x80, 0x58, 0x02, 0x81, 0x01, 0x80, 0x01, 0x81,
+    0x01, 0x40, 0x03, 0x80, 0x20, 0x01, 0x80, 0x01, 0x04, 0x80, 0x08, 0x13, 0x80, 0x08, 0x04,
+    0x80, 0x01, 0x02, 0x80, 0xc0, 0x03, 0x84, 0x31, 0x80, 0x00, 0x07, 0x0e, 0x02, 0x81, 0x07,
+    0x30, 0x01, 0x82, 0x01, 0x47, 0xf0, 0x01, 0x80, 0xff, 0x03, 0x85, 0x5f, 0xef, 0x82, 0x1f,
+    0x78, 0x10, 0x02, 0x85, 0x9d, 0xdc, 0x7f, 0xe7, 0x80, 0x10, 0x02, 0x83, 0x0f, 0xf1, 0xe3,
+    0x78, 0x04, 0x83, 0x03, 0x62, 0x35, 0x80, 0x04, 0x82, 0x01, 0xc0, 0x02, 0x02, 0x81, 0x40,
+    0x10, 0x01, 0x81, 0x08, 0x8a, 0x02, 0x81, 0xa0, 0x20, 0x02, 0x80, 0x02, 0x06, 0x82, 0x02,
+    0x22, 0x01, 0x05, 0x82, 0x08, 0x00, 0x01, 0x06, 0x80, 0x88, 0x07, 0x81, 0x40, 0x20, 0x06,
+    0x81, 0x51, 0xa0, 0x06, 0x81, 0x14, 0x80, 0x06, 0x80, 0x06, 0x3f, 0x3f, 0x14, 0x3f, 0x0c,
+    0x80, 0x60, 0x07, 0x80, 0xcc, 0x07, 0x80, 0x9a, 0x07, 0x80, 0xb1, 0x07, 0x81, 0x30, 0x80,
+    0x06, 0x81, 0x20, 0x40, 0x06, 0x81, 0x20, 0x60, 0x06, 0x81, 0x20, 0x20, 0x06, 0x81, 0x20,
+    0x30, 0x04, 0x83, 0x0f, 0x00, 0x40, 0x30, 0x04, 0x83, 0x30, 0x40, 0x40, 0x10, 0x04, 0x83,
+    0xf2, 0x10, 0x40, 0x10, 0x03, 0x84, 0x03, 0x3e, 0xe4, 0x40, 0x10, 0x03, 0x84, 0x07, 0x60,
+    0x78, 0x40, 0x10, 0x03, 0x84, 0x1b, 0x80, 0x1e, 0x40, 0x10, 0x03, 0x84, 0x76, 0x00, 0x07,
+    0x80, 0x10, 0x02, 0x85, 0x01, 0xb8, 0x00, 0x01, 0xa0, 0x10, 0x02, 0x81, 0x02, 0x60, 0x01,
+    0x80, 0x38, 0x03, 0x81, 0x0e, 0x80, 0x01, 0x80, 0x5c, 0x03, 0x80, 0x32, 0x02, 0x80, 0x47,
+    0x03, 0x80, 0xe8, 0x02, 0x81, 0x01, 0xc0, 0x01, 0x81, 0x01, 0x20, 0x03, 0x80, 0x74, 0x01,
+    0x81, 0x04, 0x80, 0x03, 0x80, 0x1d, 0x01, 0x80, 0x12, 0x04, 0x83, 0x07, 0x40, 0x00, 0x48,
+    0x04, 0x83, 0x01, 0xd0, 0x00, 0xa0, 0x05, 0x85, 0x78, 0x00, 0x87, 0x80, 0x00, 0x01, 0x01,
+    0x9b, 0x06, 0x08, 0x00, 0x47, 0xbf, 0x00, 0x01, 0x00, 0x03, 0xc6, 0x50, 0x00, 0x11, 0xfe,
+    0xff, 0x03, 0x03, 0xfb, 0xc1, 0x40, 0x00, 0x04, 0x69, 0xf0, 0xff, 0xfc, 0xf8, 0x05, 0x01,
+    0x86, 0x01, 0x00, 0x0f, 0x83, 0x9f, 0x00, 0x04, 0x02, 0x83, 0xd2, 0x22, 0x7e, 0xe0, 0x04,
+    0x82, 0x3c, 0x00, 0x02, 0x05, 0x82, 0x0f, 0x88, 0x8a, 0x05, 0x82, 0x02, 0x80, 0x02, 0x05,
+    0x82, 0x01, 0xc2, 0x22, 0x01, 0x82, 0x01, 0x80, 0x20, 0x01, 0x81, 0x78, 0x02, 0x06, 0x81,
+    0x1e, 0x8a, 0x06, 0x82, 0x05, 0x82, 0x04, 0x05, 0x82, 0x03, 0x42, 0x14, 0x06, 0x81, 0xda,
+    0x50, 0x06, 0x81, 0x3d, 0x40, 0x06, 0x80, 0x0f, 0x3f, 0x3f, 0x1d, 0x3f, 0x02, 0x80, 0x01,
+    0x07, 0x81, 0x02, 0x60, 0x06, 0x81, 0x02, 0xcc, 0x07, 0x80, 0x9a, 0x07, 0x80, 0xb1, 0x07,
+    0x80, 0x30, 0x07, 0x80, 0x20, 0x07, 0x80, 0x20, 0x07, 0x80, 0x20, 0x07, 0x80, 0x20, 0x07,
+    0x80, 0x40, 0x05, 0x82, 0x07, 0x80, 0x40, 0x05, 0x82, 0x1a, 0xe0, 0x40, 0x05, 0x82, 0x6e,
+    0xd8, 0x40, 0x04, 0x83, 0x01, 0xb3, 0xf6, 0x40, 0x04, 0x83, 0x06, 0xc1, 0x8d, 0xc0, 0x04,
+    0x83, 0x1b, 0x01, 0x13, 0x60, 0x04, 0x83, 0x6c, 0x01, 0x00, 0x98, 0x04, 0x83, 0xb0, 0x00,
+    0x44, 0x34, 0x03, 0x81, 0x03, 0xc0, 0x01, 0x80, 0x4f, 0x03, 0x85, 0x0f, 0x00, 0x01, 0x11,
+    0x53, 0xc0, 0x02, 0x82, 0x3c, 0x00, 0x01, 0x01, 0x80, 0xf0, 0x02, 0x85, 0xf0, 0x00, 0x01,
+    0x44, 0x44, 0x7c, 0x01, 0x86, 0x03, 0xc0, 0x00, 0x01, 0x00, 0x40, 0x0f, 0x01, 0x80, 0x0f,
+    0x01, 0x86, 0x01, 0x11, 0x51, 0x13, 0x40, 0x00, 0x3c, 0x01, 0x86, 0x03, 0x00, 0x40, 0x00,
+    0xd0, 0x00, 0x3f, 0x45, 0xff, 0x83, 0xf0, 0x00, 0x0f, 0x80, 0x02, 0x9c, 0x40, 0x07, 0xc0,
+    0x00, 0x34, 0x7f, 0x00, 0x01, 0x00, 0x43, 0xf8, 0xd0, 0x00, 0x0d, 0x00, 0xff, 0x03, 0x03,
+    0xbc, 0x03, 0x40, 0x00, 0x03, 0x40, 0x00, 0xff, 0xfc, 0x40, 0x0f, 0x02, 0x85, 0xf0, 0x00,
+    0x01, 0x80, 0x40, 0x3c, 0x02, 0x85, 0x3c, 0x00, 0x01, 0x00, 0x40, 0xf0, 0x02, 0x85, 0x0f,
+    0x00, 0x01, 0x00, 0x43, 0xc0, 0x02, 0x81, 0x03, 0xc0, 0x01, 0x80, 0xcf, 0x04, 0x80, 0xb0,
+    0x01, 0x81, 0xf4, 0x02, 0x03, 0x80, 0x6c, 0x01, 0x81, 0xd8, 0x01, 0x03, 0x83, 0x1b, 0x00,
+    0x03, 0xe0, 0x04, 0x82, 0x06, 0xc0, 0x0d, 0x05, 0x83, 0x01, 0xb0, 0x36, 0x80, 0x05, 0x82,
+    0x6c, 0xd8, 0x80, 0x05, 0x82, 0x1b, 0x60, 0x80, 0x05, 0x82, 0x07, 0x80, 0x80, 0x07, 0x80,
+    0x80, 0x06, 0x81, 0x01, 0x80, 0x06, 0x81, 0x01, 0x80, 0x06, 0x80, 0x01, 0x07, 0x80, 0x03,
+    0x07, 0x80, 0x02, 0x07, 0x80, 0x04, 0x10, 0x80, 0x02, 0x07, 0x80, 0x0c, 0x07, 0x80, 0x18,
+    0x3f, 0x02, 0x3f, 0x02, 0x80, 0x03, 0x07, 0x80, 0x06, 0x07, 0x80, 0x02, 0x3f, 0x18, 0x80,
+    0xc0, 0x06, 0x81, 0x02, 0x30, 0x06, 0x81, 0x03, 0x4c, 0x06, 0x81, 0x01, 0x73, 0x06, 0x82,
+    0x01, 0xed, 0xc0, 0x05, 0x82, 0x01, 0xfd, 0xb0, 0x06, 0x81, 0xbc, 0x7c, 0x06, 0x81, 0xf5,
+    0x5b, 0x05, 0x83, 0x01, 0xf1, 0x13, 0xc0, 0x04, 0x83, 0x01, 0xd5, 0x55, 0xb0, 0x04, 0x83,
+    0x01, 0xc4, 0x44, 0x7c, 0x04, 0x83, 0x7e, 0xff, 0x15, 0x5b, 0x03, 0x85, 0x7f, 0x81, 0x10,
+    0xaf, 0x13, 0x40, 0x01, 0x89, 0x3f, 0x80, 0x03, 0x00, 0x41, 0xfd, 0x90, 0x00, 0x40, 0x3f,
+    0x43, 0xff, 0x83, 0xfc, 0x04, 0x00, 0x40, 0x01, 0x84, 0x01, 0x00, 0x40, 0x00, 0x34, 0x05,
+    0x82, 0x40, 0x00, 0xd0, 0x05, 0x82, 0x40, 0x03, 0x40, 0x05, 0x81, 0x40, 0x0f, 0x06, 0x81,
+    0x40, 0x3c, 0x06, 0x81, 0x40, 0xf0, 0x06, 0x81, 0x43, 0xc0, 0x06, 0x80, 0xcf, 0x07, 0x81,
+    0xfc, 0x02, 0x06, 0x80, 0xf0, 0x06, 0x81, 0x03, 0x40, 0x06, 0x81, 0x0f, 0x80, 0x06, 0x81,
+    0x3c, 0x80, 0x06, 0x81, 0xf0, 0x80, 0x06, 0x81, 0xc0, 0x80, 0x05, 0x82, 0x02, 0x00, 0x80,
+    0x05, 0x82, 0x02, 0x00, 0x80, 0x05, 0x82, 0x02, 0x01, 0x80, 0x05, 0x82, 0x03, 0x01, 0x80,
+    0x05, 0x81, 0x03, 0x01, 0x06, 0x81, 0x01, 0x03, 0x06, 0x81, 0x01, 0x02, 0x06, 0x81, 0x01,
+    0x84, 0x07, 0x80, 0xc8, 0x07, 0x80, 0x72, 0x07, 0x80, 0x0c, 0x07, 0x80, 0x1a, 0x07, 0x80,
+    0x1c, 0x07, 0x80, 0x78, 0x30, 0x3f, 0x02, 0x80, 0x0a, 0x07, 0x80, 0x04, 0x18, 0x80, 0x20,
+    0x07, 0x80, 0x10, 0x07, 0x80, 0x10, 0x07, 0x80, 0x18, 0x07, 0x80, 0x08, 0x07, 0x80, 0x08,
+    0x07, 0x80, 0x08, 0x07, 0x81, 0x0b, 0xc0, 0x06, 0x81, 0x0e, 0x70, 0x06, 0x81, 0x3d, 0x2c,
+    0x06, 0x81, 0xf0, 0x3f, 0x05, 0x83, 0x03, 0xc0, 0xaa, 0xc0, 0x04, 0x83, 0x0f, 0x00, 0xfe,
+    0xf0, 0x04, 0x83, 0x3c, 0x00, 0xa8, 0x0c, 0x04, 0x83, 0x70, 0x00, 0xf8, 0xf2, 0x03, 0x85,
+    0x01, 0x40, 0x00, 0xa0, 0xa8, 0x80, 0x02, 0x80, 0x05, 0x01, 0x82, 0xe3, 0xff, 0x20, 0x02,
+    0x85, 0x14, 0x00, 0x1f, 0x2a, 0xaa, 0x28, 0x02, 0x85, 0x50, 0x03, 0xe0, 0x87, 0xfe, 0x0a,
+    0x01, 0x94, 0x01, 0x40, 0x7c, 0x7f, 0xff, 0x6a, 0x02, 0x80, 0x00, 0x05, 0x0f, 0xff, 0x80,
+    0x01, 0xff, 0xf0, 0xa0, 0x00, 0x15, 0xcf, 0x80, 0x01, 0x85, 0x01, 0xf2, 0xe8, 0x00, 0x01,
+    0xc0, 0x03, 0x83, 0x03, 0x80, 0x00, 0x0c, 0x05, 0x82, 0x30, 0x00, 0x13, 0x05, 0x83, 0xc8,
+    0x00, 0x04, 0xc0, 0x03, 0x84, 0x03, 0x20, 0x00, 0x01, 0x30, 0x03, 0x81, 0x0c, 0x80, 0x01,
+    0x80, 0x4c, 0x03, 0x80, 0x32, 0x02, 0x80, 0x13, 0x03, 0x80, 0xc8, 0x02, 0x81, 0x04, 0xc0,
+    0x01, 0x81, 0x03, 0xa0, 0x02, 0x81, 0x01, 0x30, 0x01, 0x81, 0x0e, 0x80, 0x03, 0x80, 0x4c,
+    0x01, 0x80, 0x3e, 0x04, 0x80, 0x33, 0x01, 0x80, 0xfc, 0x04, 0x83, 0x0c, 0xc0, 0x03, 0xf0,
+    0x04, 0x83, 0x03, 0x30, 0x0f, 0xc0, 0x05, 0x81, 0xcc, 0x3f, 0x06, 0x81, 0x33, 0xfc, 0x06,
+    0x81, 0x0c, 0xf0, 0x06, 0x81, 0x01, 0xc0, 0x06, 0x80, 0x02, 0x07, 0x80, 0x02, 0x07, 0x80,
+    0x03, 0x07, 0x80, 0x03, 0x07, 0x80, 0x01, 0x07, 0x80, 0x01, 0x07, 0x81, 0x01, 0x80, 0x07,
+    0x80, 0xc8, 0x07, 0x80, 0x70, 0x10, 0x80, 0x02, 0x07, 0x80, 0x1c, 0x07, 0x80, 0x7c, 0x07,
+    0x80, 0x38, 0x27, 0x37, 0x80, 0x06, 0x07, 0x82, 0x08, 0x00, 0x18, 0x05, 0x81, 0x03, 0x80,
+    0x06, 0x81, 0x06, 0xc0, 0x06, 0x81, 0x04, 0x40, 0x06, 0x81, 0x04, 0x20, 0x06, 0x81, 0x04,
+    0x10, 0x06, 0x81, 0x04, 0x10, 0x06, 0x81, 0x08, 0x18, 0x06, 0x81, 0x08, 0x08, 0x06, 0x81,
+    0x08, 0x08, 0x07, 0x81, 0x09, 0x80, 0x06, 0x81, 0x0d, 0x20, 0x06, 0x81, 0x15, 0x08, 0x06,
+    0x81, 0x50, 0x8a, 0x06, 0x81, 0x40, 0x28, 0x10, 0x81, 0xaa, 0x80, 0x07, 0x80, 0x20, 0x06,
+    0x81, 0xaa, 0x54, 0x05, 0x82, 0x07, 0xa0, 0xaa, 0x05, 0x82, 0x78, 0x1d, 0x55, 0x04, 0x84,
+    0x07, 0x9f, 0xfe, 0x0a, 0xa0, 0x02, 0x85, 0x40, 0x7b, 0xe0, 0x07, 0xe1, 0xfa, 0x01, 0x82,
+    0x01, 0x43, 0xfc, 0x01, 0x86, 0x3e, 0xaa, 0x80, 0x00, 0x01, 0x33, 0x80, 0x01, 0x85, 0x01,
+    0xcf, 0x80, 0x00, 0x06, 0x30, 0x03, 0x83, 0x0c, 0x60, 0x00, 0x02, 0x05, 0x80, 0x40, 0x13,
+    0x80, 0x20, 0x03, 0x80, 0x04, 0x01, 0x81, 0x01, 0x08, 0x03, 0x81, 0x10, 0x80, 0x01, 0x80,
+    0x4b, 0x03, 0x80, 0xd2, 0x02, 0x81, 0x05, 0xc0, 0x01, 0x81, 0x03, 0xe0, 0x03, 0x80, 0xb0,
+    0x01, 0x80, 0x0f, 0x04, 0x80, 0x5e, 0x01, 0x80, 0x7c, 0x04, 0x83, 0x29, 0x80, 0x01, 0xb0,
+    0x04, 0x83, 0x05, 0xf0, 0x0e, 0xc0, 0x04, 0x82, 0x02, 0x9c, 0x33, 0x06, 0x81, 0x5b, 0xcc,
+    0x06, 0x81, 0x2b, 0x32, 0x06, 0x81, 0x50, 0xca, 0x06, 0x81, 0x10, 0x28, 0x06, 0x81, 0x04,
+    0xa0, 0x06, 0x81, 0x01, 0x80, 0x3f, 0x2a, 0x80, 0x04, 0x07, 0x80, 0x38, 0x07, 0x80, 0x30,
+    0x1e, 0x2e, 0x80, 0x0c, 0x07, 0x80, 0x16, 0x07, 0x82, 0x08, 0x00, 0x10, 0x05, 0x82, 0x03,
+    0x80, 0x20, 0x05, 0x81, 0x06, 0xc0, 0x06, 0x81, 0x04, 0x40, 0x06, 0x80, 0x04, 0x07, 0x80,
+    0x04, 0x07, 0x80, 0x04, 0x07, 0x80, 0x08, 0x07, 0x80, 0x08, 0x07, 0x82, 0x08, 0x03, 0xc0,
+    0x06, 0x81, 0x0d, 0x30, 0x05, 0x82, 0x10, 0x16, 0xb8, 0x05, 0x82, 0x10, 0x78, 0x16, 0x05,
+    0x83, 0x11, 0xe0, 0x03, 0x80, 0x04, 0x83, 0x12, 0x80, 0x01, 0xc0, 0x04, 0x80, 0x1f, 0x01,
+    0x80, 0xb0, 0x04, 0x80, 0x3c, 0x01, 0x80, 0x1c, 0x04, 0x83, 0x50, 0x03, 0x80, 0x0a, 0x03,
+    0x85, 0x01, 0xe0, 0x1c, 0x90, 0x01, 0x80, 0x02, 0x85, 0x07, 0xa0, 0xe7, 0xf2, 0x00, 0xe0,
+    0x02, 0x85, 0x0e, 0x27, 0x78, 0x1e, 0x40, 0x50, 0x02, 0x85, 0x28, 0x3f, 0x80, 0x01, 0xe8,
+    0xa4, 0x02, 0x81, 0xe1, 0xb8, 0x01, 0x81, 0x1c, 0x57, 0x01, 0x82, 0x01, 0xcd, 0xc0, 0x01,
+    0x86, 0x01, 0x8a, 0x80, 0x00, 0x01, 0x4c, 0x40, 0x02, 0x80, 0x31, 0x01, 0x81, 0x04, 0x40,
+    0x03, 0x80, 0x02, 0x13, 0x81, 0x04, 0x80, 0x03, 0x84, 0x01, 0x20, 0x00, 0x01, 0x90, 0x03,
+    0x84, 0x09, 0x80, 0x00, 0x01, 0x56, 0x03, 0x81, 0x6e, 0x80, 0x01, 0x81, 0xf6, 0xc0, 0x01,
+    0x81, 0x03, 0x6b, 0x02, 0x81, 0x20, 0x78, 0x01, 0x81, 0x1f, 0x14, 0x02, 0x81, 0x0f, 0x77,
+    0x01, 0x81, 0xec, 0x50, 0x02, 0x85, 0x07, 0x04, 0xe0, 0x07, 0x71, 0xe0, 0x02, 0x85, 0x01,
+    0xd4, 0x7c, 0x39, 0x83, 0x80, 0x03, 0x83, 0x51, 0x0b, 0xce, 0x0e, 0x04, 0x83, 0x3a, 0xa0,
+    0x30, 0x3c, 0x04, 0x83, 0x0c, 0x51, 0xc0, 0xf0, 0x04, 0x83, 0x03, 0x27, 0x01, 0x40, 0x04,
+    0x83, 0x01, 0x85, 0x07, 0x80, 0x05, 0x81, 0x7f, 0x1e, 0x06, 0x81, 0x1d, 0xe8, 0x06, 0x81,
+    0x0d, 0x70, 0x06, 0x81, 0x03, 0xc0, 0x3f, 0x33, 0x80, 0x30, 0x07, 0x80, 0x20, 0x15, 0x25,
+    0x80, 0x18, 0x07, 0x80, 0x0c, 0x07, 0x80, 0x10, 0x12, 0x80, 0x20, 0x3f, 0x05, 0x81, 0x02,
+    0x40, 0x06, 0x81, 0x0a, 0x50, 0x05, 0x82, 0x10, 0x08, 0xa0, 0x05, 0x82, 0x10, 0x48, 0x52,
+    0x05, 0x83, 0x11, 0x40, 0xaa, 0x80, 0x04, 0x82, 0x11, 0x22, 0x55, 0x05, 0x83, 0x18, 0x07,
+    0xaa, 0x90, 0x04, 0x83, 0x28, 0x98, 0xb5, 0x54, 0x05, 0x82, 0xe3, 0xd2, 0xa8, 0x03, 0x85,
+    0x01, 0x03, 0x1c, 0x3a, 0x54, 0x80, 0x02, 0x85, 0x05, 0x3c, 0xe0, 0x07, 0x6a, 0xa0, 0x02,
+    0x81, 0x04, 0xc7, 0x01, 0x81, 0xed, 0x40, 0x02, 0x81, 0x21, 0xb8, 0x01, 0x81, 0x1c, 0xa4,
+    0x02, 0x81, 0xaf, 0xc0, 0x01, 0x81, 0x03, 0xd5, 0x02, 0x80, 0xbe, 0x03, 0x80, 0x7a, 0x01,
+    0x81, 0x01, 0xb0, 0x03, 0x80, 0x0d, 0x01, 0x82, 0x05, 0x80, 0x40, 0x02, 0x85, 0x01, 0x80,
+    0x00, 0x04, 0x00, 0x40, 0x03, 0x80, 0x20, 0x02, 0x80, 0x40, 0x05, 0x82, 0x04, 0x40, 0x80,
+    0x02, 0x81, 0x02, 0x20, 0x01, 0x81, 0x4c, 0x80, 0x02, 0x80, 0x32, 0x02, 0x81, 0x05, 0x80,
+    0x01, 0x81, 0x01, 0xb0, 0x02, 0x81, 0xa6, 0x38, 0x01, 0x81, 0x1d, 0x81, 0x02, 0x85, 0x25,
+    0x47, 0x80, 0x01, 0xfc, 0x04, 0x02, 0x84, 0x07, 0xfb, 0x78, 0x1e, 0xe0, 0x03, 0x85, 0x05,
+    0x50, 0x4f, 0xe7, 0x00, 0xa0, 0x02, 0x85, 0x03, 0x71, 0xfc, 0x38, 0x00, 0x80, 0x03, 0x83,
+    0x01, 0x51, 0xc0, 0x04, 0x04, 0x83, 0x2f, 0xfc, 0x00, 0x14, 0x04, 0x83, 0x09, 0x50, 0x00,
+    0x10, 0x05, 0x82, 0xf0, 0x80, 0x80, 0x04, 0x83, 0x01, 0x00, 0x82, 0x80, 0x05, 0x81, 0x40,
+    0x82, 0x07, 0x80, 0x50, 0x06, 0x81, 0x0a, 0x10, 0x06, 0x81, 0x02, 0x40, 0x3f, 0x3c, 0x80,
+    0x20, 0x15, 0x25, 0x80, 0x38, 0x3f, 0x2b, 0x81, 0x01, 0x80, 0x06, 0x81, 0x05, 0x20, 0x06,
+    0x81, 0x15, 0x08, 0x06, 0x80, 0x12, 0x07, 0x80, 0x17, 0x06, 0x83, 0x02, 0x9a, 0xe0, 0x40,
+    0x04, 0x82, 0x03, 0x67, 0xf8, 0x05, 0x82, 0x03, 0x18, 0x1e, 0x02, 0x80, 0x08, 0x01, 0x83,
+    0x16, 0xe0, 0x07, 0x80, 0x04, 0x80, 0x1b, 0x01, 0x80, 0xe0, 0x04, 0x80, 0x7c, 0x01, 0x80,
+    0x38, 0x03, 0x81, 0x03, 0x60, 0x01, 0x80, 0x06, 0x03, 0x81, 0x27, 0x80, 0x01, 0x81, 0x01,
+    0x84, 0x02, 0x80, 0x16, 0x03, 0x80, 0x60, 0x02, 0x81, 0x50, 0x40, 0x02, 0x80, 0x08, 0x02,
+    0x81, 0x40, 0x40, 0x02, 0x80, 0x02, 0x03, 0x80, 0x40, 0x07, 0x80, 0x40, 0x05, 0x82, 0x02,
+    0x00, 0x40, 0x03, 0x80, 0x40, 0x01, 0x81, 0x30, 0x80, 0x02, 0x84, 0x0c, 0x60, 0x00, 0x01,
+    0xc3, 0x02, 0x81, 0x01, 0xcc, 0x02, 0x81, 0x51, 0xfc, 0x01, 0x81, 0x3f, 0xc0, 0x02, 0x85,
+    0x17, 0xfb, 0xe0, 0x87, 0xde, 0x04, 0x02, 0x85, 0x27, 0x77, 0x1f, 0xf9, 0xe0, 0x04, 0x02,
+    0x83, 0x03, 0xfc, 0x78, 0xde, 0x05, 0x82, 0xd8, 0x8d, 0x60, 0x04, 0x83, 0x02, 0x70, 0x00,
+    0x80, 0x04, 0x83, 0x02, 0x02, 0x22, 0x80, 0x04, 0x80, 0x02, 0x01, 0x80, 0x80, 0x04, 0x84,
+    0x06, 0x00, 0x88, 0x80, 0x40, 0x03, 0x81, 0x06, 0x02, 0x01, 0x80, 0x40, 0x03, 0x82, 0x04,
+    0x00, 0x22, 0x05, 0x83, 0x04, 0x00, 0x10, 0x08, 0x04, 0x83, 0x04, 0x00, 0x14, 0x68, 0x06,
+    0x81, 0x05, 0x20, 0x06, 0x81, 0x01, 0x80, 0x3f, 0x3f, 0x13, 0x25, 0x80, 0x60, 0x3f, 0x34,
+    0x81, 0x03, 0xc0, 0x06, 0x81, 0x0e, 0x30, 0x06, 0x81, 0x36, 0x0c, 0x06, 0x81, 0xe7, 0x73,
+    0x05, 0x83, 0x01, 0x78, 0x1c, 0x80, 0x04, 0x83, 0x04, 0x60, 0x07, 0x20, 0x04, 0x83, 0x17,
+    0x80, 0x01, 0xc8, 0x01, 0x80, 0x08, 0x01, 0x80, 0x46, 0x01, 0x80, 0x72, 0x01, 0x80, 0x08,
+    0x01, 0x80, 0xf8, 0x01, 0x80, 0x1d, 0x03, 0x81, 0x02, 0xe0, 0x01, 0x81, 0x06, 0x40, 0x02,
+    0x81, 0x09, 0x80, 0x01, 0x81, 0x01, 0x90, 0x02, 0x80, 0x2e, 0x03, 0x80, 0x64, 0x02, 0x80,
+    0x18, 0x03, 0x80, 0x18, 0x02, 0x80, 0x60, 0x03, 0x80, 0x06, 0x01, 0x81, 0x01, 0x80, 0x03,
+    0x83, 0x01, 0x80, 0x00, 0x06, 0x05, 0x82, 0x60, 0x00, 0x18, 0x05, 0x83, 0x18, 0x00, 0x01,
+    0xc0, 0x01, 0x8c, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0xcf, 0x80, 0x00, 0x80, 0x01, 0xf3,
+    0x80, 0x01, 0x85, 0xff, 0xff, 0x81, 0x81, 0xff, 0xf0, 0x02, 0x84, 0x3a, 0x7c, 0x7f, 0xfe,
+    0x3e, 0x03, 0x85, 0x10, 0x03, 0xe0, 0x47, 0xc0, 0x04, 0x02, 0x85, 0x20, 0x88, 0x9f, 0x78,
+    0x00, 0x14, 0x02, 0x80, 0x0a, 0x01, 0x82, 0x40, 0x00, 0x50, 0x02, 0x85, 0x02, 0xa2, 0x22,
+    0x80, 0x01, 0x40, 0x03, 0x83, 0xc0, 0x00, 0x80, 0x03, 0x03, 0x84, 0x02, 0x58, 0x88, 0x80,
+    0x0a, 0x03, 0x84, 0x02, 0x14, 0x00, 0x80, 0x28, 0x03, 0x84, 0x06, 0x05, 0x22, 0x80, 0xa0,
+    0x03, 0x84, 0x06, 0x01, 0xc0, 0x83, 0x80, 0x03, 0x83, 0x04, 0x00, 0xf8, 0x8f, 0x04, 0x83,
+    0x04, 0x00, 0x3c, 0xbc, 0x04, 0x83, 0x04, 0x00, 0x0d, 0x70, 0x04, 0x83, 0x08, 0x00, 0x03,
+    0xc0, 0x04, 0x80, 0x08, 0x07, 0x80, 0x18, 0x07, 0x80, 0x10, 0x3f, 0x3f, 0x04, 0x25, 0x80,
+    0x40, 0x3f, 0x3d, 0x81, 0x03, 0xc0, 0x06, 0x81, 0x0f, 0xf0, 0x06, 0x81, 0x3f, 0x4c, 0x06,
+    0x81, 0xf3, 0xf3, 0x05, 0x83, 0x03, 0xc1, 0x8c, 0xc0, 0x04, 0x83, 0x0f, 0x01, 0x13, 0x30,
+    0x04, 0x83, 0x3c, 0x01, 0x00, 0xcc, 0x01, 0x80, 0x08, 0x01, 0x83, 0x70, 0x00, 0x44, 0x72,
+    0x01, 0x83, 0x08, 0x00, 0x01, 0x40, 0x01, 0x81, 0x0d, 0x80, 0x02, 0x85, 0x05, 0x00, 0x01,
+    0x11, 0x13, 0x60, 0x02, 0x82, 0x14, 0x00, 0x01, 0x01, 0x80, 0xd8, 0x02, 0x85, 0x50, 0x00,
+    0x01, 0x44, 0x44, 0x76, 0x01, 0x83, 0x01, 0x40, 0x00, 0x01, 0x01, 0x83, 0x0d, 0x80, 0x00,
+    0x05, 0x01, 0x86, 0x01, 0x11, 0x11, 0x13, 0xe0, 0x00, 0x14, 0x01, 0x80, 0x03, 0x02, 0x82,
+    0xf8, 0x00, 0x5f, 0x45, 0xff, 0x9d, 0xfc, 0x00, 0x4f, 0xc0, 0x00, 0x01, 0x80, 0x00, 0x03,
+    0xc4, 0x00, 0x10, 0x3f, 0x80, 0x00, 0x80, 0x01, 0xfc, 0xf8, 0x00, 0x04, 0x00, 0x7f, 0x81,
+    0x81, 0xfe, 0x03, 0xe0, 0x00, 0x01, 0x01, 0x84, 0x7f, 0xfe, 0x00, 0x0d, 0x80, 0x01, 0x80,
+    0x50, 0x01, 0x82, 0xc0, 0x00, 0x36, 0x02, 0x80, 0x14, 0x01, 0x82, 0x80, 0x00, 0xd8, 0x02,
+    0x80, 0x05, 0x01, 0x82, 0x80, 0x03, 0x60, 0x02, 0x81, 0x01, 0x40, 0x01, 0x81, 0x0d, 0x80,
+    0x03, 0x80, 0x70, 0x01, 0x80, 0x32, 0x04, 0x80, 0x3c, 0x01, 0x80, 0xcc, 0x04, 0x83, 0x0f,
+    0x00, 0x03, 0x30, 0x04, 0x83, 0x03, 0xc0, 0x0c, 0xc0, 0x05, 0x81, 0xf0, 0x33, 0x06, 0x81,
+    0x3c, 0xcc, 0x06, 0x81, 0x0f, 0x30, 0x06, 0x81, 0x03, 0xc0, 0x04, 0x80, 0x08, 0x07, 0x80,
+    0x08, 0x07, 0x80, 0x18, 0x07, 0x80, 0x10, 0x07, 0x80, 0x20, 0x07, 0x80, 0x20, 0x3f, 0x32,
+    0x3f, 0x3f, 0x2d, 0x81, 0x04, 0x80, 0x06, 0x81, 0x14, 0x20, 0x06, 0x81, 0x52, 0x88, 0x05,
+    0x82, 0x01, 0x40, 0x72, 0x05, 0x83, 0x05, 0x00, 0xee, 0x80, 0x04, 0x83, 0x14, 0x00, 0xfa,
+    0x20, 0x04, 0x83, 0x50, 0x01, 0xb4, 0x68, 0x01, 0x86, 0x08, 0x00, 0x01, 0x40, 0x01, 0xea,
+    0xa2, 0x01, 0x82, 0x08, 0x00, 0x05, 0x01, 0x86, 0xd1, 0x12, 0x80, 0x00, 0x08, 0x00, 0x14,
+    0x01, 0x82, 0xaa, 0xaa, 0x20, 0x02, 0x80, 0x50, 0x01, 0x82, 0x44, 0x44, 0x68, 0x01, 0x86,
+    0x01, 0x40, 0x00, 0xfe, 0xfe, 0xaa, 0xa2, 0x01, 0x86, 0x05, 0x00, 0xff, 0x01, 0x12, 0xed,
+    0x12, 0x01, 0x86, 0x14, 0x7f, 0x00, 0x03, 0x00, 0x03, 0xfa, 0x02, 0x80, 0x7f, 0x43, 0xff,
+    0x80, 0xf8, 0x01, 0x80, 0x10, 0x01, 0x80, 0x01, 0x02, 0x82, 0x20, 0x00, 0x14, 0x05, 0x82,
+    0x80, 0x00, 0x05, 0x04, 0x80, 0x02, 0x01, 0x81, 0x01, 0x40, 0x03, 0x80, 0x0a, 0x02, 0x80,
+    0x50, 0x03, 0x80, 0x28, 0x02, 0x80, 0x14, 0x03, 0x80, 0xa0, 0x02, 0x80, 0x05, 0x02, 0x81,
+    0x02, 0x80, 0x02, 0x81, 0x01, 0x40, 0x01, 0x80, 0x0a, 0x04, 0x80, 0x50, 0x01, 0x80, 0x28,
+    0x04, 0x80, 0x14, 0x01, 0x80, 0xa0, 0x04, 0x83, 0x05, 0x00, 0x02, 0x80, 0x04, 0x82, 0x01,
+    0x40, 0x0a, 0x06, 0x81, 0x50, 0x28, 0x06, 0x81, 0x14, 0xa0, 0x06, 0x81, 0x04, 0x80, 0x31,
+    0x80, 0x20, 0x07, 0x80, 0x20, 0x07, 0x80, 0x40, 0x3f, 0x29,
+};
+
+const struct delta_anim crystal_anim = {
+    .w = 69,
+    .h = 68,
+    .frame_count = 16,
+    .loop = 194,
+    .data = crystal_anim_stream,
+};
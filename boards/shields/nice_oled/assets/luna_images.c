@@ -1,3 +1,6 @@
+/* LV_IMG_CF_USER_ENCODED_0 images are run-length encoded by scripts/encode_image.py,
+ * see widgets/rle_img.h */
+
 #include <lvgl.h>
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
@@ -13,829 +16,67 @@
  * MACROS PARA ATRIBUTOS DE IMÁGENES SEGÚN FRAME Y ORIENTACIÓN
  *------------------------------------------------------------------*/
 /* DOG SIT1 */
-#ifndef LV_ATTRIBUTE_IMG_DOG_SIT1
-#define LV_ATTRIBUTE_IMG_DOG_SIT1
-#endif
 #ifndef LV_ATTRIBUTE_IMG_DOG_SIT1_90
 #define LV_ATTRIBUTE_IMG_DOG_SIT1_90
 #endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_SIT1_180
-#define LV_ATTRIBUTE_IMG_DOG_SIT1_180
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_SIT1_270
-#define LV_ATTRIBUTE_IMG_DOG_SIT1_270
-#endif
 
 /* DOG SIT2 */
-#ifndef LV_ATTRIBUTE_IMG_DOG_SIT2
-#define LV_ATTRIBUTE_IMG_DOG_SIT2
-#endif
 #ifndef LV_ATTRIBUTE_IMG_DOG_SIT2_90
 #define LV_ATTRIBUTE_IMG_DOG_SIT2_90
 #endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_SIT2_180
-#define LV_ATTRIBUTE_IMG_DOG_SIT2_180
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_SIT2_270
-#define LV_ATTRIBUTE_IMG_DOG_SIT2_270
-#endif
 
 /* DOG WALK1 */
-#ifndef LV_ATTRIBUTE_IMG_DOG_WALK1
-#define LV_ATTRIBUTE_IMG_DOG_WALK1
-#endif
 #ifndef LV_ATTRIBUTE_IMG_DOG_WALK1_90
 #define LV_ATTRIBUTE_IMG_DOG_WALK1_90
 #endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_WALK1_180
-#define LV_ATTRIBUTE_IMG_DOG_WALK1_180
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_WALK1_270
-#define LV_ATTRIBUTE_IMG_DOG_WALK1_270
-#endif
 
 /* DOG WALK2 */
-#ifndef LV_ATTRIBUTE_IMG_DOG_WALK2
-#define LV_ATTRIBUTE_IMG_DOG_WALK2
-#endif
 #ifndef LV_ATTRIBUTE_IMG_DOG_WALK2_90
 #define LV_ATTRIBUTE_IMG_DOG_WALK2_90
 #endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_WALK2_180
-#define LV_ATTRIBUTE_IMG_DOG_WALK2_180
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_WALK2_270
-#define LV_ATTRIBUTE_IMG_DOG_WALK2_270
-#endif
 
 /* DOG RUN1 */
-#ifndef LV_ATTRIBUTE_IMG_DOG_RUN1
-#define LV_ATTRIBUTE_IMG_DOG_RUN1
-#endif
 #ifndef LV_ATTRIBUTE_IMG_DOG_RUN1_90
 #define LV_ATTRIBUTE_IMG_DOG_RUN1_90
 #endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_RUN1_180
-#define LV_ATTRIBUTE_IMG_DOG_RUN1_180
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_RUN1_270
-#define LV_ATTRIBUTE_IMG_DOG_RUN1_270
-#endif
-
-/* DOG RUN2 */
-#ifndef LV_ATTRIBUTE_IMG_DOG_RUN2
-#define LV_ATTRIBUTE_IMG_DOG_RUN2
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_RUN2_90
-#define LV_ATTRIBUTE_IMG_DOG_RUN2_90
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_RUN2_180
-#define LV_ATTRIBUTE_IMG_DOG_RUN2_180
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_RUN2_270
-#define LV_ATTRIBUTE_IMG_DOG_RUN2_270
-#endif
-
-/* DOG BARK1 */
-#ifndef LV_ATTRIBUTE_IMG_DOG_BARK1
-#define LV_ATTRIBUTE_IMG_DOG_BARK1
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_BARK1_90
-#define LV_ATTRIBUTE_IMG_DOG_BARK1_90
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_BARK1_180
-#define LV_ATTRIBUTE_IMG_DOG_BARK1_180
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_BARK1_270
-#define LV_ATTRIBUTE_IMG_DOG_BARK1_270
-#endif
-
-/* DOG BARK2 */
-#ifndef LV_ATTRIBUTE_IMG_DOG_BARK2
-#define LV_ATTRIBUTE_IMG_DOG_BARK2
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_BARK2_90
-#define LV_ATTRIBUTE_IMG_DOG_BARK2_90
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_BARK2_180
-#define LV_ATTRIBUTE_IMG_DOG_BARK2_180
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_BARK2_270
-#define LV_ATTRIBUTE_IMG_DOG_BARK2_270
-#endif
-
-/* DOG SNEAK1 */
-#ifndef LV_ATTRIBUTE_IMG_DOG_SNEAK1
-#define LV_ATTRIBUTE_IMG_DOG_SNEAK1
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_SNEAK1_90
-#define LV_ATTRIBUTE_IMG_DOG_SNEAK1_90
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_SNEAK1_180
-#define LV_ATTRIBUTE_IMG_DOG_SNEAK1_180
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_SNEAK1_270
-#define LV_ATTRIBUTE_IMG_DOG_SNEAK1_270
-#endif
-
-/* DOG SNEAK2 */
-#ifndef LV_ATTRIBUTE_IMG_DOG_SNEAK2
-#define LV_ATTRIBUTE_IMG_DOG_SNEAK2
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_SNEAK2_90
-#define LV_ATTRIBUTE_IMG_DOG_SNEAK2_90
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_SNEAK2_180
-#define LV_ATTRIBUTE_IMG_DOG_SNEAK2_180
-#endif
-#ifndef LV_ATTRIBUTE_IMG_DOG_SNEAK2_270
-#define LV_ATTRIBUTE_IMG_DOG_SNEAK2_270
-#endif
-
-/*------------------------------------------------------------------
- * MAPAS DE IMÁGENES (ARRAYS DE BYTES)
- * Para cada frame se definen cuatro versiones:
- *   - Orientación 180: resolución 32x24px
- *   - Orientaciones 0, 90 y 270: resolución 24x32px
- *   - CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ para QMK!!
- *   - CONFIG_NICE_OLED_WIDGET_LUNA_HORIZONTAL_READ para ZMK!!!
- *------------------------------------------------------------------*/
-
-/* DOG SIT1 */
-// Orientación 0 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SIT1 uint8_t
-    dog_sit1_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, /* Color de índice 0 */
-        0xff, 0xff, 0xff, 0xff, /* Color de índice 1 */
-#else
-        0xff, 0xff, 0xff, 0xff, /* Color de índice 0 */
-        0x00, 0x00, 0x00, 0xff, /* Color de índice 1 */
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xe0, 0x1c, 0x02, 0x05, 0x02, 0x24, 0x04, 0x04, 0x02, 0xa9, 0x1e, 0xe0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x10, 0x08, 0x68,
-        0x10, 0x08, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x82,
-        0x7c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x02, 0x04, 0x0c, 0x10, 0x10, 0x20, 0x20, 0x20, 0x28, 0x3e, 0x1c, 0x20, 0x20,
-        0x3e, 0x0f, 0x11, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xa2, 0x80, 0x00, 0x01, 0x5c, 0x80, 0x00, 0x01, 0x01,
-        0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x02, 0x11, 0x40, 0x00, 0x02, 0x00, 0x40, 0x00, 0x02,
-        0x01, 0x40, 0x00, 0x04, 0x00, 0x40, 0x00, 0x04, 0x07, 0x40, 0x00, 0x08, 0x02, 0x80, 0x00,
-        0xd0, 0x00, 0x80, 0x01, 0x20, 0x00, 0x80, 0x02, 0x40, 0x00, 0x80, 0x02, 0x40, 0x00, 0x80,
-        0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x07, 0x00, 0x01, 0x00, 0x8d, 0x00, 0x00, 0xc0, 0xcd,
-        0x00, 0x00, 0x41, 0xcd, 0x00, 0x00, 0x30, 0xcb, 0x00, 0x00, 0x0f, 0xb8, 0x00
-#endif
-};
-
-// Orientación 90 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SIT1_90 uint8_t
-    dog_sit1_map_90[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x02, 0x10, 0x00, 0x04, 0x08, 0x00, 0x0c,
-        0x68, 0x00, 0x10, 0x10, 0x00, 0x10, 0x08, 0x00, 0x20, 0x04, 0x00, 0x20, 0x03, 0x00,
-        0x20, 0x00, 0xe0, 0x28, 0x00, 0x1c, 0x3e, 0x00, 0x02, 0x1c, 0x00, 0x05, 0x20, 0x00,
-        0x02, 0x20, 0x00, 0x24, 0x3e, 0x00, 0x04, 0x0f, 0x02, 0x04, 0x11, 0x06, 0x02, 0x1f,
-        0x82, 0xa9, 0x00, 0x7c, 0x1e, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-#endif
-};
-
-// Orientación 180 (32x24)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SIT1_180 uint8_t
-    dog_sit1_map_180[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-// Orientación 270 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SIT1_270 uint8_t
-    dog_sit1_map_270[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-/* DOG SIT2 */
-// Orientación 0 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SIT2 uint8_t
-    dog_sit2_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xe0, 0x1c, 0x02, 0x05, 0x02, 0x24, 0x04, 0x04, 0x02, 0xa9, 0x1e, 0xe0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x90, 0x08, 0x18, 0x60,
-        0x10, 0x08, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x82,
-        0x7c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x02, 0x04, 0x0c, 0x10, 0x10, 0x20, 0x20, 0x20, 0x28, 0x3e, 0x1c, 0x20, 0x20,
-        0x3e, 0x0f, 0x11, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xa2, 0x80, 0x00, 0x01, 0x5c, 0x80, 0x00, 0x01, 0x01,
-        0x80, 0x00, 0x01, 0x00, 0x80, 0x00, 0x02, 0x11, 0x40, 0x00, 0x02, 0x00, 0x40, 0x00, 0x02,
-        0x01, 0x40, 0x00, 0x04, 0x00, 0x40, 0x00, 0x04, 0x07, 0x40, 0x00, 0x08, 0x02, 0x80, 0x01,
-        0x90, 0x02, 0x80, 0x02, 0xa0, 0x00, 0x80, 0x04, 0x40, 0x00, 0x80, 0x04, 0x40, 0x00, 0x80,
-        0x06, 0x00, 0x01, 0x00, 0x02, 0x00, 0x07, 0x00, 0x01, 0x00, 0x8d, 0x00, 0x00, 0xc0, 0xcd,
-        0x00, 0x00, 0x41, 0xcd, 0x00, 0x00, 0x30, 0xcb, 0x00, 0x00, 0x0f, 0xb8, 0x00
-#endif
-};
-
-// Orientación 90 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SIT2_90 uint8_t
-    dog_sit2_map_90[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xe0, 0x00, 0x01, 0x90, 0x00, 0x02, 0x08, 0x00, 0x04, 0x18, 0x00, 0x0c,
-        0x60, 0x00, 0x10, 0x10, 0x00, 0x10, 0x08, 0x00, 0x20, 0x04, 0x00, 0x20, 0x03, 0x00,
-        0x20, 0x00, 0xe0, 0x28, 0x00, 0x1c, 0x3e, 0x00, 0x02, 0x1c, 0x00, 0x05, 0x20, 0x00,
-        0x02, 0x20, 0x00, 0x24, 0x3e, 0x00, 0x04, 0x0f, 0x02, 0x04, 0x11, 0x0e, 0x02, 0x1f,
-        0x82, 0xa9, 0x00, 0x7c, 0x1e, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-#endif
-};
-
-// Orientación 180 (32x24)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SIT2_180 uint8_t
-    dog_sit2_map_180[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-// Orientación 270 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SIT2_270 uint8_t
-    dog_sit2_map_270[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-/* DOG WALK1 */
-// Orientación 0 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_WALK1 uint8_t
-    dog_walk1_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 0x90, 0x90, 0x90, 0xa0, 0xc0,
-        0x80, 0x80, 0x80, 0x70, 0x08, 0x14, 0x08, 0x90, 0x10, 0x10, 0x08, 0xa4, 0x78, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0xfc, 0x01, 0x00,
-        0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-        0x18, 0xea, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x03, 0x1c, 0x20, 0x20, 0x3c, 0x0f, 0x11, 0x1f, 0x03, 0x06, 0x18, 0x20, 0x20,
-        0x3c, 0x0c, 0x12, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00, 0x28,
-        0xa0, 0x00, 0xf0, 0x57, 0x20, 0x01, 0x08, 0x40, 0x60, 0x02, 0x04, 0x40, 0x20, 0x04, 0x7f,
-        0x84, 0x50, 0x04, 0x80, 0x80, 0x10, 0x04, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x10, 0x03,
-        0x00, 0x01, 0xd0, 0x01, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x40,
-        0x01, 0x04, 0x00, 0x40, 0x01, 0x0f, 0x00, 0x80, 0x01, 0x0b, 0x83, 0x00, 0x00, 0x9a, 0x8d,
-        0x00, 0x00, 0x9a, 0x4d, 0x00, 0x00, 0x96, 0x4b, 0x00, 0x00, 0x70, 0x38, 0x00
-#endif
-};
-
-// Orientación 90 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_WALK1_90 uint8_t
-    dog_walk1_map_90[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x07, 0x80, 0x00, 0x08, 0x40, 0x03, 0xfc, 0x20, 0x1c, 0x01, 0x10, 0x20,
-        0x00, 0x90, 0x20, 0x00, 0x90, 0x3c, 0x00, 0x90, 0x0f, 0x00, 0xa0, 0x11, 0x80, 0xc0,
-        0x1f, 0x00, 0x80, 0x03, 0x00, 0x80, 0x06, 0x01, 0x80, 0x18, 0x00, 0x70, 0x20, 0x00,
-        0x08, 0x20, 0x00, 0x14, 0x3c, 0x00, 0x08, 0x0c, 0x00, 0x90, 0x12, 0x00, 0x10, 0x1e,
-        0x08, 0x10, 0x01, 0x18, 0x08, 0x00, 0xea, 0xa4, 0x00, 0x10, 0x78, 0x00, 0x0f, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-#endif
-};
-
-// Orientación 180 (32x24)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_WALK1_180 uint8_t
-    dog_walk1_map_180[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-// Orientación 270 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_WALK1_270 uint8_t
-    dog_walk1_map_270[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-/* DOG WALK2 */
-// Orientación 0 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_WALK2 uint8_t
-    dog_walk2_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x20, 0x20, 0x40, 0x80, 0x00,
-        0x00, 0x00, 0x00, 0xe0, 0x10, 0x28, 0x10, 0x20, 0x20, 0x20, 0x10, 0x48, 0xf0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x20, 0xf8, 0x02, 0x01,
-        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
-        0x30, 0xd5, 0x20, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x3f, 0x20, 0x30, 0x0c, 0x02, 0x05, 0x09, 0x12, 0x1e, 0x02, 0x1c, 0x14, 0x08,
-        0x10, 0x20, 0x2c, 0x32, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-        0x40, 0x00, 0x00, 0x28, 0xa0, 0x00, 0xe0, 0x57, 0x20, 0x01, 0x10, 0x40, 0x60, 0x02, 0x08,
-        0x40, 0x20, 0x04, 0x7f, 0x84, 0x50, 0x04, 0x80, 0x80, 0x10, 0x04, 0x00, 0x00, 0x50, 0x05,
-        0x00, 0x00, 0x10, 0x05, 0x00, 0x01, 0xd0, 0x03, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x40,
-        0x01, 0x00, 0x00, 0x40, 0x01, 0x0c, 0x00, 0x80, 0x01, 0x13, 0x81, 0x00, 0x01, 0x29, 0x62,
-        0x00, 0x01, 0x25, 0x52, 0x00, 0x01, 0x43, 0x69, 0x00, 0x01, 0xc0, 0x07, 0x00
-#endif
-};
-
-// Orientación 90 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_WALK2_90 uint8_t
-    dog_walk2_map_90[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1f, 0x00, 0x00, 0x20, 0x80, 0x3f, 0xf8, 0x40, 0x20, 0x02, 0x20, 0x30,
-        0x01, 0x20, 0x0c, 0x01, 0x20, 0x02, 0x01, 0x40, 0x05, 0x01, 0x80, 0x09, 0x01, 0x00,
-        0x12, 0x01, 0x00, 0x1e, 0x01, 0x00, 0x02, 0x03, 0x00, 0x1c, 0x00, 0xe0, 0x14, 0x00,
-        0x10, 0x08, 0x00, 0x28, 0x10, 0x00, 0x10, 0x20, 0x01, 0x20, 0x2c, 0x00, 0x20, 0x32,
-        0x10, 0x20, 0x01, 0x30, 0x10, 0x00, 0xd5, 0x48, 0x00, 0x20, 0xf0, 0x00, 0x1f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-#endif
-};
-
-// Orientación 180 (32x24)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_WALK2_180 uint8_t
-    dog_walk2_map_180[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-// Orientación 270 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_WALK2_270 uint8_t
-    dog_walk2_map_270[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-/* DOG RUN1 */
-// Orientación 0 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_RUN1 uint8_t
-    dog_run1_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0x00, 0x00, 0x00, 0xe0, 0x10, 0x08, 0x08, 0xc8, 0xb0, 0x80, 0x80, 0x80, 0x80,
-        0x80, 0x80, 0x80, 0x40, 0x40, 0x3c, 0x14, 0x04, 0x08, 0x90, 0x18, 0x04, 0x08, 0xb0,
-        0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xc4, 0xa4, 0xfc, 0x00,
-        0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-        0xc8, 0x58, 0x28, 0x2a, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
-        0x09, 0x04, 0x04, 0x04, 0x04, 0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08,
-        0x10, 0x26, 0x2b, 0x32, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-#else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x40, 0x03, 0x80, 0x12,
-        0xa0, 0x04, 0x40, 0x19, 0x90, 0x08, 0x40, 0x10, 0x10, 0x08, 0x80, 0x60, 0x08, 0x08, 0xff,
-        0x81, 0x14, 0x08, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x14, 0x03, 0x80, 0x00, 0x04, 0x00,
-        0x80, 0x00, 0xf4, 0x00, 0x80, 0x00, 0x48, 0x01, 0x80, 0x00, 0x30, 0x02, 0x80, 0x00, 0xc0,
-        0x03, 0x84, 0x01, 0x80, 0x02, 0x0b, 0x02, 0x40, 0x04, 0x1c, 0xc7, 0x20, 0x05, 0xe0, 0x24,
-        0xe0, 0x06, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00
-#endif
-};
-
-// Orientación 90 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_RUN1_90 uint8_t
-    dog_run1_map_90[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0xe0, 0x0e, 0x02, 0x10, 0x09, 0xc4, 0x08, 0x04, 0xa4, 0x08, 0x04, 0xfc, 0xc8, 0x04,
-        0x00, 0xb0, 0x04, 0x00, 0x80, 0x02, 0x00, 0x80, 0x03, 0x00, 0x80, 0x02, 0x80, 0x80,
-        0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0x80, 0x02, 0x00, 0x40, 0x04, 0x00,
-        0x40, 0x08, 0x00, 0x3c, 0x10, 0x00, 0x14, 0x26, 0x00, 0x04, 0x2b, 0x00, 0x08, 0x32,
-        0x80, 0x90, 0x04, 0xc8, 0x18, 0x05, 0x58, 0x04, 0x06, 0x28, 0x08, 0x00, 0x2a, 0xb0,
-        0x00, 0x10, 0x40, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-#endif
-};
-
-// Orientación 180 (32x24)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_RUN1_180 uint8_t
-    dog_run1_map_180[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-// Orientación 270 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_RUN1_270 uint8_t
-    dog_run1_map_270[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-/* DOG RUN2 */
-// Orientación 0 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_RUN2 uint8_t
-    dog_run2_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0x00, 0x00, 0xe0, 0x10, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x80, 0x80, 0x80, 0x78, 0x28, 0x08, 0x10, 0x20, 0x30, 0x08, 0x10, 0x20, 0x40,
-        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x08, 0x10, 0x11, 0xf9, 0x01,
-        0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x10, 0xb0, 0x50, 0x55, 0x20, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x02, 0x0c, 0x10, 0x20, 0x28, 0x37, 0x02, 0x1e, 0x20, 0x20,
-        0x18, 0x0c, 0x14, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-        0x80, 0x0e, 0x00, 0x25, 0x40, 0x12, 0x00, 0x33, 0x20, 0x12, 0x00, 0x20, 0x10, 0x12, 0x01,
-        0xc0, 0x08, 0x11, 0xfe, 0x01, 0x14, 0x10, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x14, 0x04,
-        0x80, 0x00, 0x04, 0x03, 0x80, 0x00, 0xf4, 0x00, 0x80, 0x00, 0x48, 0x00, 0x80, 0x00, 0x30,
-        0x00, 0x80, 0x00, 0x40, 0x00, 0x41, 0x00, 0x80, 0x00, 0x21, 0xc1, 0x00, 0x00, 0x11, 0x47,
-        0x00, 0x00, 0x12, 0x4d, 0x00, 0x00, 0x09, 0x4b, 0x00, 0x00, 0x07, 0x30, 0x00
-#endif
-};
-
-// Orientación 90 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_RUN2_90 uint8_t
-    dog_run2_map_90[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x04,
-        0x10, 0x00, 0x08, 0x10, 0x00, 0x10, 0xf0, 0x00, 0x11, 0x00, 0x00, 0xf9, 0x00, 0x01,
-        0x01, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x01, 0x00,
-        0x28, 0x01, 0x00, 0x37, 0x00, 0x80, 0x02, 0x00, 0x80, 0x1e, 0x00, 0x80, 0x20, 0x00,
-        0x78, 0x20, 0x00, 0x28, 0x18, 0x00, 0x08, 0x0c, 0x00, 0x10, 0x14, 0x00, 0x20, 0x1e,
-        0x01, 0x30, 0x01, 0x10, 0x08, 0x00, 0xb0, 0x10, 0x00, 0x50, 0x20, 0x00, 0x55, 0x40,
-        0x00, 0x20, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-#endif
-};
-
-// Orientación 180 (32x24)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_RUN2_180 uint8_t
-    dog_run2_map_180[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-// Orientación 270 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_RUN2_270 uint8_t
-    dog_run2_map_270[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
-
-/* DOG BARK1 */
-// Orientación 0 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK1 uint8_t
-    dog_bark1_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0xc0, 0x20, 0x10, 0xd0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-        0x80, 0x40, 0x3c, 0x14, 0x04, 0x08, 0x90, 0x18, 0x04, 0x08, 0xb0, 0x40, 0x80, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x08, 0x10, 0x11, 0xf9, 0x01, 0x01, 0x01,
-        0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc8, 0x48, 0x28,
-        0x2a, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x02, 0x0c, 0x10, 0x20, 0x28, 0x37, 0x02, 0x02, 0x04, 0x08, 0x10, 0x26,
-        0x2b, 0x32, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x95,
-        0x00, 0x1c, 0x00, 0xcc, 0x80, 0x24, 0x00, 0x80, 0x80, 0x48, 0x01, 0x00, 0x40, 0x48, 0x06,
-        0x08, 0xa0, 0x47, 0xf8, 0x00, 0x20, 0x40, 0x00, 0x00, 0xa0, 0x20, 0x00, 0x00, 0x20, 0x12,
-        0x00, 0x07, 0xa0, 0x0e, 0x00, 0x00, 0x40, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x06, 0x00,
-        0x02, 0x00, 0x0c, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x87, 0x1c, 0x80, 0x00, 0x44, 0x93,
-        0x80, 0x00, 0x48, 0x48, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x1c, 0x1c, 0x00
-#endif
-};
-
-// Orientación 90 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK1_90 uint8_t
-    dog_bark1_map_90[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x04, 0x20, 0x00, 0x08, 0x10, 0x00, 0x10, 0xd0,
-        0x00, 0x11, 0x30, 0x00, 0xf9, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x01, 0x00,
-        0x10, 0x01, 0x00, 0x20, 0x01, 0x00, 0x28, 0x01, 0x00, 0x37, 0x00, 0x80, 0x02, 0x00, 0x80,
-        0x02, 0x00, 0x40, 0x04, 0x00, 0x3c, 0x08, 0x00, 0x14, 0x10, 0x00, 0x04, 0x26, 0x00, 0x08,
-        0x2b, 0x80, 0x90, 0x32, 0xc8, 0x18, 0x04, 0x48, 0x04, 0x05, 0x28, 0x08, 0x06, 0x2a, 0xb0,
-        0x00, 0x10, 0x40, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-#endif
-};
-
-// Orientación 180 (32x24)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK1_180 uint8_t
-    dog_bark1_map_180[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
-#endif
-
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
-#endif
-};
 
-// Orientación 270 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK1_270 uint8_t
-    dog_bark1_map_270[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
+/* DOG RUN2 */
+#ifndef LV_ATTRIBUTE_IMG_DOG_RUN2_90
+#define LV_ATTRIBUTE_IMG_DOG_RUN2_90
 #endif
 
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
-#else
-// TODO
+/* DOG BARK1 */
+#ifndef LV_ATTRIBUTE_IMG_DOG_BARK1_90
+#define LV_ATTRIBUTE_IMG_DOG_BARK1_90
 #endif
-};
 
 /* DOG BARK2 */
-// Orientación 0 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK2 uint8_t
-    dog_bark2_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
+#ifndef LV_ATTRIBUTE_IMG_DOG_BARK2_90
+#define LV_ATTRIBUTE_IMG_DOG_BARK2_90
 #endif
 
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0xe0, 0x10, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-        0x80, 0x40, 0x40, 0x2c, 0x14, 0x04, 0x08, 0x90, 0x18, 0x04, 0x08, 0xb0, 0x40, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x08, 0x10, 0x11, 0xf9, 0x01, 0x01, 0x01,
-        0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x48,
-        0x28, 0x2a, 0x10, 0x0f, 0x20, 0x4a, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x02, 0x0c, 0x10, 0x20, 0x28, 0x37, 0x02, 0x02, 0x04, 0x08, 0x10, 0x26,
-        0x2b, 0x32, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x4a,
-        0x80, 0x38, 0x00, 0x26, 0x40, 0x48, 0x00, 0x40, 0x40, 0x48, 0x01, 0x80, 0x20, 0x48, 0x06,
-        0x04, 0x50, 0x47, 0xf8, 0x00, 0x12, 0x40, 0x00, 0x00, 0x54, 0x20, 0x00, 0x00, 0x10, 0x12,
-        0x00, 0x01, 0xd6, 0x0e, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x03, 0x04,
-        0x02, 0x00, 0x06, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x87, 0x1c, 0x80, 0x00, 0x44, 0x93,
-        0x80, 0x00, 0x48, 0x48, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00, 0x1c, 0x1c, 0x00
+/* DOG SNEAK1 */
+#ifndef LV_ATTRIBUTE_IMG_DOG_SNEAK1_90
+#define LV_ATTRIBUTE_IMG_DOG_SNEAK1_90
 #endif
-};
 
-// Orientación 90 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK2_90 uint8_t
-    dog_bark2_map_90[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-#else
-        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
+/* DOG SNEAK2 */
+#ifndef LV_ATTRIBUTE_IMG_DOG_SNEAK2_90
+#define LV_ATTRIBUTE_IMG_DOG_SNEAK2_90
 #endif
 
-#if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0xe0, 0x10, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-        0x80, 0x40, 0x40, 0x2c, 0x14, 0x04, 0x08, 0x90, 0x18, 0x04, 0x08, 0xb0, 0x40, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x08, 0x10, 0x11, 0xf9, 0x01, 0x01, 0x01,
-        0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x48,
-        0x28, 0x2a, 0x10, 0x0f, 0x20, 0x4a, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x02, 0x0c, 0x10, 0x20, 0x28, 0x37, 0x02, 0x02, 0x04, 0x08, 0x10, 0x26,
-        0x2b, 0x32, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x04, 0x10, 0x00, 0x08, 0x10, 0x00, 0x10, 0xf0,
-        0x00, 0x11, 0x00, 0x00, 0xf9, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x01, 0x00,
-        0x10, 0x01, 0x00, 0x20, 0x01, 0x00, 0x28, 0x01, 0x00, 0x37, 0x00, 0x80, 0x02, 0x00, 0x80,
-        0x02, 0x00, 0x40, 0x04, 0x00, 0x40, 0x08, 0x00, 0x2c, 0x10, 0x00, 0x14, 0x26, 0x00, 0x04,
-        0x2b, 0x00, 0x08, 0x32, 0x80, 0x90, 0x04, 0xc0, 0x18, 0x05, 0x48, 0x04, 0x06, 0x28, 0x08,
-        0x00, 0x2a, 0xb0, 0x00, 0x10, 0x40, 0x00, 0x0f, 0x80, 0x00, 0x20, 0x00, 0x00, 0x4a, 0x00,
-        0x00, 0x09, 0x00, 0x00, 0x10, 0x00
-#endif
-};
+/*------------------------------------------------------------------
+ * MAPAS DE IMÁGENES (ARRAYS DE BYTES)
+ * Cada frame en orientación 90, resolución 24x32px, la única para la
+ * que están dispuestos los widgets:
+ *   - CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ para QMK!!
+ *   - CONFIG_NICE_OLED_WIDGET_LUNA_HORIZONTAL_READ para ZMK!!!
+ *------------------------------------------------------------------*/
 
-// Orientación 180 (32x24)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK2_180 uint8_t
-    dog_bark2_map_180[] = {
+/* DOG SIT1 */
+// Orientación 90 (24x32)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SIT1_90 uint8_t
+    dog_sit1_map_90[] = {
 #if CONFIG_NICE_VIEW_WIDGET_INVERTED
         0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
 #else
@@ -845,13 +86,19 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK2
 #if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
 // TODO
 #else
-// TODO
+        0x90, 0x00, 0x3b, 0x01, 0xe0, 0x00, 0x02, 0x10, 0x00, 0x04, 0x08, 0x00,
+        0x0c, 0x68, 0x00, 0x10, 0x10, 0x00, 0x10, 0x08, 0x00, 0x20, 0x04, 0x00,
+        0x20, 0x03, 0x00, 0x20, 0x00, 0xe0, 0x28, 0x00, 0x1c, 0x3e, 0x00, 0x02,
+        0x1c, 0x00, 0x05, 0x20, 0x00, 0x02, 0x20, 0x00, 0x24, 0x3e, 0x00, 0x04,
+        0x0f, 0x02, 0x04, 0x11, 0x06, 0x02, 0x1f, 0x82, 0xa9, 0x00, 0x7c, 0x1e,
+        0x00, 0x03, 0xe0, 0x90, 0x00,
 #endif
 };
 
-// Orientación 270 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK2_270 uint8_t
-    dog_bark2_map_270[] = {
+/* DOG SIT2 */
+// Orientación 90 (24x32)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SIT2_90 uint8_t
+    dog_sit2_map_90[] = {
 #if CONFIG_NICE_VIEW_WIDGET_INVERTED
         0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
 #else
@@ -861,14 +108,19 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK2
 #if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
 // TODO
 #else
-// TODO
+        0x8e, 0x00, 0x3d, 0xe0, 0x00, 0x01, 0x90, 0x00, 0x02, 0x08, 0x00, 0x04,
+        0x18, 0x00, 0x0c, 0x60, 0x00, 0x10, 0x10, 0x00, 0x10, 0x08, 0x00, 0x20,
+        0x04, 0x00, 0x20, 0x03, 0x00, 0x20, 0x00, 0xe0, 0x28, 0x00, 0x1c, 0x3e,
+        0x00, 0x02, 0x1c, 0x00, 0x05, 0x20, 0x00, 0x02, 0x20, 0x00, 0x24, 0x3e,
+        0x00, 0x04, 0x0f, 0x02, 0x04, 0x11, 0x0e, 0x02, 0x1f, 0x82, 0xa9, 0x00,
+        0x7c, 0x1e, 0x00, 0x03, 0xe0, 0x90, 0x00,
 #endif
 };
 
-/* DOG SNEAK1 */
-// Orientación 0 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK1 uint8_t
-    dog_sneak1_map[] = {
+/* DOG WALK1 */
+// Orientación 90 (24x32)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_WALK1_90 uint8_t
+    dog_walk1_map_90[] = {
 #if CONFIG_NICE_VIEW_WIDGET_INVERTED
         0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
 #else
@@ -876,30 +128,22 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK
 #endif
 
 #if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x40, 0x80, 0x00, 0x80, 0x40, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x21, 0xf0, 0x04, 0x02, 0x02,
-        0x02, 0x02, 0x03, 0x02, 0x02, 0x04, 0x04, 0x04, 0x03, 0x01, 0x00, 0x00, 0x09, 0x01,
-        0x80, 0x80, 0xab, 0x04, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x1c, 0x20, 0x20, 0x3c, 0x0f, 0x11, 0x1f, 0x02, 0x06, 0x18, 0x20, 0x20, 0x38,
-        0x08, 0x10, 0x18, 0x04, 0x04, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
+// TODO
 #else
-        // Output
-        // Code output format: Arduino code, single bitmap
-        // Draw mode: Horizontal - 1 bit per pixel
-        // Generate code:
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x38, 0x80, 0x02, 0x10,
-        0x25, 0x40, 0x04, 0x08, 0x33, 0x20, 0x08, 0xfe, 0x20, 0x20, 0x09, 0x01, 0xc0, 0x10, 0x08,
-        0x00, 0x02, 0x28, 0x0a, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x08,
-        0x02, 0x00, 0x00, 0xe8, 0x02, 0x1c, 0x00, 0x10, 0x02, 0x17, 0x00, 0x60, 0x01, 0x35, 0x01,
-        0x80, 0x01, 0x34, 0x9a, 0x00, 0x01, 0x2c, 0x96, 0x00, 0x00, 0xe0, 0x70, 0x00
+        0x8e, 0x00, 0x43, 0x07, 0x80, 0x00, 0x08, 0x40, 0x03, 0xfc, 0x20, 0x1c,
+        0x01, 0x10, 0x20, 0x00, 0x90, 0x20, 0x00, 0x90, 0x3c, 0x00, 0x90, 0x0f,
+        0x00, 0xa0, 0x11, 0x80, 0xc0, 0x1f, 0x00, 0x80, 0x03, 0x00, 0x80, 0x06,
+        0x01, 0x80, 0x18, 0x00, 0x70, 0x20, 0x00, 0x08, 0x20, 0x00, 0x14, 0x3c,
+        0x00, 0x08, 0x0c, 0x00, 0x90, 0x12, 0x00, 0x10, 0x1e, 0x08, 0x10, 0x01,
+        0x18, 0x08, 0x00, 0xea, 0xa4, 0x00, 0x10, 0x78, 0x00, 0x0f, 0x80, 0x8a,
+        0x00,
 #endif
 };
 
+/* DOG WALK2 */
 // Orientación 90 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK1_90 uint8_t
-    dog_sneak1_map_90[] = {
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_WALK2_90 uint8_t
+    dog_walk2_map_90[] = {
 #if CONFIG_NICE_VIEW_WIDGET_INVERTED
         0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
 #else
@@ -909,19 +153,19 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK
 #if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
 // TODO
 #else
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
-        0x00, 0x00, 0x21, 0x00, 0x03, 0xf0, 0x80, 0x1c, 0x04, 0x40, 0x20, 0x02, 0x40, 0x20,
-        0x02, 0x40, 0x3c, 0x02, 0x40, 0x0f, 0x02, 0x80, 0x11, 0x03, 0x00, 0x1f, 0x02, 0x00,
-        0x02, 0x02, 0x00, 0x06, 0x04, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04, 0x00, 0x20, 0x03,
-        0xc0, 0x38, 0x01, 0x40, 0x08, 0x00, 0x40, 0x10, 0x00, 0x80, 0x18, 0x09, 0x00, 0x04,
-        0x01, 0x80, 0x04, 0x80, 0x40, 0x02, 0x80, 0x80, 0x02, 0xab, 0x00, 0x01, 0x04, 0x00,
-        0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        0x8e, 0x00, 0x42, 0x1f, 0x00, 0x00, 0x20, 0x80, 0x3f, 0xf8, 0x40, 0x20,
+        0x02, 0x20, 0x30, 0x01, 0x20, 0x0c, 0x01, 0x20, 0x02, 0x01, 0x40, 0x05,
+        0x01, 0x80, 0x09, 0x01, 0x00, 0x12, 0x01, 0x00, 0x1e, 0x01, 0x00, 0x02,
+        0x03, 0x00, 0x1c, 0x00, 0xe0, 0x14, 0x00, 0x10, 0x08, 0x00, 0x28, 0x10,
+        0x00, 0x10, 0x20, 0x01, 0x20, 0x2c, 0x00, 0x20, 0x32, 0x10, 0x20, 0x01,
+        0x30, 0x10, 0x00, 0xd5, 0x48, 0x00, 0x20, 0xf0, 0x00, 0x1f, 0x8b, 0x00,
 #endif
 };
 
-// Orientación 180 (32x24)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK1_180 uint8_t
-    dog_sneak1_map_180[] = {
+/* DOG RUN1 */
+// Orientación 90 (24x32)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_RUN1_90 uint8_t
+    dog_run1_map_90[] = {
 #if CONFIG_NICE_VIEW_WIDGET_INVERTED
         0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
 #else
@@ -931,13 +175,20 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK
 #if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
 // TODO
 #else
-// TODO
+        0x8b, 0x00, 0x4c, 0x01, 0xe0, 0x0e, 0x02, 0x10, 0x09, 0xc4, 0x08, 0x04,
+        0xa4, 0x08, 0x04, 0xfc, 0xc8, 0x04, 0x00, 0xb0, 0x04, 0x00, 0x80, 0x02,
+        0x00, 0x80, 0x03, 0x00, 0x80, 0x02, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01,
+        0x00, 0x80, 0x02, 0x00, 0x80, 0x02, 0x00, 0x40, 0x04, 0x00, 0x40, 0x08,
+        0x00, 0x3c, 0x10, 0x00, 0x14, 0x26, 0x00, 0x04, 0x2b, 0x00, 0x08, 0x32,
+        0x80, 0x90, 0x04, 0xc8, 0x18, 0x05, 0x58, 0x04, 0x06, 0x28, 0x08, 0x00,
+        0x2a, 0xb0, 0x00, 0x10, 0x40, 0x00, 0x0f, 0x80, 0x84, 0x00,
 #endif
 };
 
-// Orientación 270 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK1_270 uint8_t
-    dog_sneak1_map_270[] = {
+/* DOG RUN2 */
+// Orientación 90 (24x32)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_RUN2_90 uint8_t
+    dog_run2_map_90[] = {
 #if CONFIG_NICE_VIEW_WIDGET_INVERTED
         0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
 #else
@@ -947,14 +198,20 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK
 #if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
 // TODO
 #else
-// TODO
+        0x88, 0x00, 0x4e, 0x03, 0xe0, 0x00, 0x04, 0x10, 0x00, 0x08, 0x10, 0x00,
+        0x10, 0xf0, 0x00, 0x11, 0x00, 0x00, 0xf9, 0x00, 0x01, 0x01, 0x00, 0x02,
+        0x01, 0x00, 0x0c, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x01, 0x00, 0x28,
+        0x01, 0x00, 0x37, 0x00, 0x80, 0x02, 0x00, 0x80, 0x1e, 0x00, 0x80, 0x20,
+        0x00, 0x78, 0x20, 0x00, 0x28, 0x18, 0x00, 0x08, 0x0c, 0x00, 0x10, 0x14,
+        0x00, 0x20, 0x1e, 0x01, 0x30, 0x01, 0x10, 0x08, 0x00, 0xb0, 0x10, 0x00,
+        0x50, 0x20, 0x00, 0x55, 0x40, 0x00, 0x20, 0x80, 0x00, 0x1f, 0x85, 0x00,
 #endif
 };
 
-/* DOG SNEAK2 */
-// Orientación 0 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK2 uint8_t
-    dog_sneak2_map[] = {
+/* DOG BARK1 */
+// Orientación 90 (24x32)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK1_90 uint8_t
+    dog_bark1_map_90[] = {
 #if CONFIG_NICE_VIEW_WIDGET_INVERTED
         0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
 #else
@@ -962,30 +219,26 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK
 #endif
 
 #if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xe0, 0xa0, 0x20, 0x40, 0x80, 0xc0, 0x20, 0x40, 0x80, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x41, 0xf0, 0x04, 0x02, 0x02,
-        0x02, 0x03, 0x02, 0x02, 0x02, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
-        0x40, 0x40, 0x55, 0x82, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x3f, 0x20, 0x30, 0x0c, 0x02, 0x05, 0x09, 0x12, 0x1e, 0x04, 0x18, 0x10, 0x08, 0x10,
-        0x20, 0x28, 0x34, 0x06, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+// TODO
 #else
         // Output
         // Code output format: Arduino code, single bitmap
         // Draw mode: Horizontal - 1 bit per pixel
         // Generate code:
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x80, 0x01, 0xc0, 0x25, 0x40, 0x02, 0x20,
-        0x33, 0x20, 0x04, 0x10, 0x20, 0x20, 0x08, 0xfe, 0x40, 0x10, 0x09, 0x01, 0x82, 0x28, 0x08,
-        0x00, 0x00, 0x08, 0x0a, 0x00, 0x00, 0x28, 0x0a, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0xe8,
-        0x02, 0x00, 0x00, 0x10, 0x02, 0x18, 0x00, 0x60, 0x02, 0x26, 0x01, 0x80, 0x02, 0x53, 0x03,
-        0x00, 0x02, 0x4a, 0xa4, 0x00, 0x02, 0x86, 0xd2, 0x00, 0x03, 0x80, 0x0e, 0x00
+        0x82, 0x00, 0x4c, 0x03, 0xc0, 0x00, 0x04, 0x20, 0x00, 0x08, 0x10, 0x00,
+        0x10, 0xd0, 0x00, 0x11, 0x30, 0x00, 0xf9, 0x00, 0x01, 0x01, 0x00, 0x02,
+        0x01, 0x00, 0x0c, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x01, 0x00, 0x28,
+        0x01, 0x00, 0x37, 0x00, 0x80, 0x02, 0x00, 0x80, 0x02, 0x00, 0x40, 0x04,
+        0x00, 0x3c, 0x08, 0x00, 0x14, 0x10, 0x00, 0x04, 0x26, 0x00, 0x08, 0x2b,
+        0x80, 0x90, 0x32, 0xc8, 0x18, 0x04, 0x48, 0x04, 0x05, 0x28, 0x08, 0x06,
+        0x2a, 0xb0, 0x00, 0x10, 0x40, 0x00, 0x0f, 0x80, 0x8d, 0x00,
 #endif
 };
 
+/* DOG BARK2 */
 // Orientación 90 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK2_90 uint8_t
-    dog_sneak2_map_90[] = {
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_BARK2_90 uint8_t
+    dog_bark2_map_90[] = {
 #if CONFIG_NICE_VIEW_WIDGET_INVERTED
         0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
 #else
@@ -993,21 +246,32 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK
 #endif
 
 #if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
-// TODO
+        0x04, 0x00, 0xe0, 0x10, 0x10, 0xf0, 0x86, 0x00, 0x0e, 0x80, 0x80, 0x40,
+        0x40, 0x2c, 0x14, 0x04, 0x08, 0x90, 0x18, 0x04, 0x08, 0xb0, 0x40, 0x80,
+        0x83, 0x00, 0x05, 0x03, 0x04, 0x08, 0x10, 0x11, 0xf9, 0x84, 0x01, 0x86,
+        0x00, 0x0a, 0x80, 0xc0, 0x48, 0x28, 0x2a, 0x10, 0x0f, 0x20, 0x4a, 0x09,
+        0x10, 0x85, 0x00, 0x11, 0x01, 0x02, 0x0c, 0x10, 0x20, 0x28, 0x37, 0x02,
+        0x02, 0x04, 0x08, 0x10, 0x26, 0x2b, 0x32, 0x04, 0x05, 0x06, 0x85, 0x00,
 #else
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e,
-        0x00, 0x00, 0x41, 0x00, 0x3f, 0xf0, 0x80, 0x20, 0x04, 0x40, 0x30, 0x02, 0x40, 0x0c,
-        0x02, 0x40, 0x02, 0x02, 0x80, 0x05, 0x03, 0x00, 0x09, 0x02, 0x00, 0x12, 0x02, 0x00,
-        0x1e, 0x02, 0x00, 0x04, 0x04, 0x00, 0x18, 0x04, 0x00, 0x10, 0x02, 0x00, 0x08, 0x01,
-        0xe0, 0x10, 0x00, 0xa0, 0x20, 0x00, 0x20, 0x28, 0x00, 0x40, 0x34, 0x04, 0x80, 0x06,
-        0x00, 0xc0, 0x02, 0x40, 0x20, 0x01, 0x40, 0x40, 0x01, 0x55, 0x80, 0x00, 0x82, 0x00,
-        0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        // Output
+        // Code output format: Arduino code, single bitmap
+        // Draw mode: Horizontal - 1 bit per pixel
+        // Generate code:
+        0x82, 0x00, 0x5b, 0x03, 0xe0, 0x00, 0x04, 0x10, 0x00, 0x08, 0x10, 0x00,
+        0x10, 0xf0, 0x00, 0x11, 0x00, 0x00, 0xf9, 0x00, 0x01, 0x01, 0x00, 0x02,
+        0x01, 0x00, 0x0c, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x01, 0x00, 0x28,
+        0x01, 0x00, 0x37, 0x00, 0x80, 0x02, 0x00, 0x80, 0x02, 0x00, 0x40, 0x04,
+        0x00, 0x40, 0x08, 0x00, 0x2c, 0x10, 0x00, 0x14, 0x26, 0x00, 0x04, 0x2b,
+        0x00, 0x08, 0x32, 0x80, 0x90, 0x04, 0xc0, 0x18, 0x05, 0x48, 0x04, 0x06,
+        0x28, 0x08, 0x00, 0x2a, 0xb0, 0x00, 0x10, 0x40, 0x00, 0x0f, 0x80, 0x00,
+        0x20, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00,
 #endif
 };
 
-// Orientación 180 (32x24)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK2_180 uint8_t
-    dog_sneak2_map_180[] = {
+/* DOG SNEAK1 */
+// Orientación 90 (24x32)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK1_90 uint8_t
+    dog_sneak1_map_90[] = {
 #if CONFIG_NICE_VIEW_WIDGET_INVERTED
         0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
 #else
@@ -1017,13 +281,20 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK
 #if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
 // TODO
 #else
-// TODO
+        0x8b, 0x00, 0x48, 0x1e, 0x00, 0x00, 0x21, 0x00, 0x03, 0xf0, 0x80, 0x1c,
+        0x04, 0x40, 0x20, 0x02, 0x40, 0x20, 0x02, 0x40, 0x3c, 0x02, 0x40, 0x0f,
+        0x02, 0x80, 0x11, 0x03, 0x00, 0x1f, 0x02, 0x00, 0x02, 0x02, 0x00, 0x06,
+        0x04, 0x00, 0x18, 0x04, 0x00, 0x20, 0x04, 0x00, 0x20, 0x03, 0xc0, 0x38,
+        0x01, 0x40, 0x08, 0x00, 0x40, 0x10, 0x00, 0x80, 0x18, 0x09, 0x00, 0x04,
+        0x01, 0x80, 0x04, 0x80, 0x40, 0x02, 0x80, 0x80, 0x02, 0xab, 0x00, 0x01,
+        0x04, 0x00, 0x00, 0xf8, 0x88, 0x00,
 #endif
 };
 
-// Orientación 270 (24x32)
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK2_270 uint8_t
-    dog_sneak2_map_270[] = {
+/* DOG SNEAK2 */
+// Orientación 90 (24x32)
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK2_90 uint8_t
+    dog_sneak2_map_90[] = {
 #if CONFIG_NICE_VIEW_WIDGET_INVERTED
         0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
 #else
@@ -1033,7 +304,13 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK
 #if CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ
 // TODO
 #else
-// TODO
+        0x8b, 0x00, 0x48, 0x3e, 0x00, 0x00, 0x41, 0x00, 0x3f, 0xf0, 0x80, 0x20,
+        0x04, 0x40, 0x30, 0x02, 0x40, 0x0c, 0x02, 0x40, 0x02, 0x02, 0x80, 0x05,
+        0x03, 0x00, 0x09, 0x02, 0x00, 0x12, 0x02, 0x00, 0x1e, 0x02, 0x00, 0x04,
+        0x04, 0x00, 0x18, 0x04, 0x00, 0x10, 0x02, 0x00, 0x08, 0x01, 0xe0, 0x10,
+        0x00, 0xa0, 0x20, 0x00, 0x20, 0x28, 0x00, 0x40, 0x34, 0x04, 0x80, 0x06,
+        0x00, 0xc0, 0x02, 0x40, 0x20, 0x01, 0x40, 0x40, 0x01, 0x55, 0x80, 0x00,
+        0x82, 0x00, 0x00, 0x7c, 0x88, 0x00,
 #endif
 };
 
@@ -1042,18 +319,8 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_DOG_SNEAK
  *------------------------------------------------------------------*/
 
 /* DOG SIT1 */
-const lv_img_dsc_t dog_sit1 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32, /* Ancho de la imagen */
-    .header.h = 22, /* Alto de la imagen */
-    .data_size = sizeof(dog_sit1_map),
-    .data = dog_sit1_map,
-};
-
 const lv_img_dsc_t dog_sit1_90 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 24,
@@ -1062,39 +329,9 @@ const lv_img_dsc_t dog_sit1_90 = {
     .data = dog_sit1_map_90,
 };
 
-const lv_img_dsc_t dog_sit1_180 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 24,
-    .data_size = sizeof(dog_sit1_map_180),
-    .data = dog_sit1_map_180,
-};
-
-const lv_img_dsc_t dog_sit1_270 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 24,
-    .header.h = 32,
-    .data_size = sizeof(dog_sit1_map_270),
-    .data = dog_sit1_map_270,
-};
-
 /* DOG SIT2 */
-const lv_img_dsc_t dog_sit2 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 22,
-    .data_size = sizeof(dog_sit2_map),
-    .data = dog_sit2_map,
-};
-
 const lv_img_dsc_t dog_sit2_90 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 24,
@@ -1103,39 +340,9 @@ const lv_img_dsc_t dog_sit2_90 = {
     .data = dog_sit2_map_90,
 };
 
-const lv_img_dsc_t dog_sit2_180 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 24,
-    .data_size = sizeof(dog_sit2_map_180),
-    .data = dog_sit2_map_180,
-};
-
-const lv_img_dsc_t dog_sit2_270 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 24,
-    .header.h = 32,
-    .data_size = sizeof(dog_sit2_map_270),
-    .data = dog_sit2_map_270,
-};
-
 /* DOG WALK1 */
-const lv_img_dsc_t dog_walk1 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 22,
-    .data_size = sizeof(dog_walk1_map),
-    .data = dog_walk1_map,
-};
-
 const lv_img_dsc_t dog_walk1_90 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 24,
@@ -1144,39 +351,9 @@ const lv_img_dsc_t dog_walk1_90 = {
     .data = dog_walk1_map_90,
 };
 
-const lv_img_dsc_t dog_walk1_180 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 24,
-    .data_size = sizeof(dog_walk1_map_180),
-    .data = dog_walk1_map_180,
-};
-
-const lv_img_dsc_t dog_walk1_270 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 24,
-    .header.h = 32,
-    .data_size = sizeof(dog_walk1_map_270),
-    .data = dog_walk1_map_270,
-};
-
 /* DOG WALK2 */
-const lv_img_dsc_t dog_walk2 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 22,
-    .data_size = sizeof(dog_walk2_map),
-    .data = dog_walk2_map,
-};
-
 const lv_img_dsc_t dog_walk2_90 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 24,
@@ -1185,39 +362,9 @@ const lv_img_dsc_t dog_walk2_90 = {
     .data = dog_walk2_map_90,
 };
 
-const lv_img_dsc_t dog_walk2_180 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 24,
-    .data_size = sizeof(dog_walk2_map_180),
-    .data = dog_walk2_map_180,
-};
-
-const lv_img_dsc_t dog_walk2_270 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 24,
-    .header.h = 32,
-    .data_size = sizeof(dog_walk2_map_270),
-    .data = dog_walk2_map_270,
-};
-
 /* DOG RUN1 */
-const lv_img_dsc_t dog_run1 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 22,
-    .data_size = sizeof(dog_run1_map),
-    .data = dog_run1_map,
-};
-
 const lv_img_dsc_t dog_run1_90 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 24,
@@ -1226,39 +373,9 @@ const lv_img_dsc_t dog_run1_90 = {
     .data = dog_run1_map_90,
 };
 
-const lv_img_dsc_t dog_run1_180 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 24,
-    .data_size = sizeof(dog_run1_map_180),
-    .data = dog_run1_map_180,
-};
-
-const lv_img_dsc_t dog_run1_270 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 24,
-    .header.h = 32,
-    .data_size = sizeof(dog_run1_map_270),
-    .data = dog_run1_map_270,
-};
-
 /* DOG RUN2 */
-const lv_img_dsc_t dog_run2 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 22,
-    .data_size = sizeof(dog_run2_map),
-    .data = dog_run2_map,
-};
-
 const lv_img_dsc_t dog_run2_90 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 24,
@@ -1267,39 +384,9 @@ const lv_img_dsc_t dog_run2_90 = {
     .data = dog_run2_map_90,
 };
 
-const lv_img_dsc_t dog_run2_180 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 24,
-    .data_size = sizeof(dog_run2_map_180),
-    .data = dog_run2_map_180,
-};
-
-const lv_img_dsc_t dog_run2_270 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 24,
-    .header.h = 32,
-    .data_size = sizeof(dog_run2_map_270),
-    .data = dog_run2_map_270,
-};
-
 /* DOG BARK1 */
-const lv_img_dsc_t dog_bark1 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 22,
-    .data_size = sizeof(dog_bark1_map),
-    .data = dog_bark1_map,
-};
-
 const lv_img_dsc_t dog_bark1_90 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 24,
@@ -1308,39 +395,9 @@ const lv_img_dsc_t dog_bark1_90 = {
     .data = dog_bark1_map_90,
 };
 
-const lv_img_dsc_t dog_bark1_180 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 24,
-    .data_size = sizeof(dog_bark1_map_180),
-    .data = dog_bark1_map_180,
-};
-
-const lv_img_dsc_t dog_bark1_270 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 24,
-    .header.h = 32,
-    .data_size = sizeof(dog_bark1_map_270),
-    .data = dog_bark1_map_270,
-};
-
 /* DOG BARK2 */
-const lv_img_dsc_t dog_bark2 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 22,
-    .data_size = sizeof(dog_bark2_map),
-    .data = dog_bark2_map,
-};
-
 const lv_img_dsc_t dog_bark2_90 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 24,
@@ -1349,39 +406,9 @@ const lv_img_dsc_t dog_bark2_90 = {
     .data = dog_bark2_map_90,
 };
 
-const lv_img_dsc_t dog_bark2_180 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 24,
-    .data_size = sizeof(dog_bark2_map_180),
-    .data = dog_bark2_map_180,
-};
-
-const lv_img_dsc_t dog_bark2_270 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 24,
-    .header.h = 32,
-    .data_size = sizeof(dog_bark2_map_270),
-    .data = dog_bark2_map_270,
-};
-
 /* DOG SNEAK1 */
-const lv_img_dsc_t dog_sneak1 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 22,
-    .data_size = sizeof(dog_sneak1_map),
-    .data = dog_sneak1_map,
-};
-
 const lv_img_dsc_t dog_sneak1_90 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 24,
@@ -1390,39 +417,9 @@ const lv_img_dsc_t dog_sneak1_90 = {
     .data = dog_sneak1_map_90,
 };
 
-const lv_img_dsc_t dog_sneak1_180 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 24,
-    .data_size = sizeof(dog_sneak1_map_180),
-    .data = dog_sneak1_map_180,
-};
-
-const lv_img_dsc_t dog_sneak1_270 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 24,
-    .header.h = 32,
-    .data_size = sizeof(dog_sneak1_map_270),
-    .data = dog_sneak1_map_270,
-};
-
 /* DOG SNEAK2 */
-const lv_img_dsc_t dog_sneak2 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 22,
-    .data_size = sizeof(dog_sneak2_map),
-    .data = dog_sneak2_map,
-};
-
 const lv_img_dsc_t dog_sneak2_90 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 24,
@@ -1430,23 +427,3 @@ const lv_img_dsc_t dog_sneak2_90 = {
     .data_size = sizeof(dog_sneak2_map_90),
     .data = dog_sneak2_map_90,
 };
-
-const lv_img_dsc_t dog_sneak2_180 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 32,
-    .header.h = 24,
-    .data_size = sizeof(dog_sneak2_map_180),
-    .data = dog_sneak2_map_180,
-};
-
-const lv_img_dsc_t dog_sneak2_270 = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 24,
-    .header.h = 32,
-    .data_size = sizeof(dog_sneak2_map_270),
-    .data = dog_sneak2_map_270,
-};
@@ -0,0 +1,348 @@
+/* Generated by scripts/encode_animation.py from scripts/animations/pokemon.c, do not edit */
+/* 20 frames of 140x68, 4983 bytes instead of 24640 */
+
+#include "../widgets/delta_anim.h"
+
+static const uint8_t pokemon_anim_stream[] = {
+    0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80,
+    0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff,
+    0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50,
+    0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0,
+    0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80,
+    0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff,
+    0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50,
+    0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0,
+    0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x47, 0xff, 0x81, 0xfc, 0x7f, 0x46, 0xff,
+    0x80, 0xf0, 0x47, 0xff, 0x82, 0xfc, 0xfb, 0x9f, 0x45, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x80,
+    0x87, 0x45, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x80, 0x83, 0x45, 0xff, 0x80, 0xf0, 0x49, 0xff,
+    0x80, 0x03, 0x45, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x80, 0xc7, 0x45, 0xff, 0x80, 0xf0, 0x49,
+    0xff, 0x80, 0xe1, 0x45, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x80, 0x80, 0x45, 0xff, 0x80, 0xf0,
+    0x49, 0xff, 0x81, 0x80, 0x7f, 0x44, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x81, 0x80, 0x3f, 0x44,
+    0xff, 0x80, 0xf0, 0x49, 0xff, 0x81, 0xf0, 0x1f, 0x44, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x81,
+    0xf8, 0x1f, 0x44, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x81, 0xf0, 0x0f, 0x44, 0xff, 0x80, 0xf0,
+    0x49, 0xff, 0x81, 0xf0, 0x0f, 0x44, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x81, 0xf0, 0x0f, 0x44,
+    0xff, 0x80, 0xf0, 0x49, 0xff, 0x81, 0xf0, 0x07, 0x44, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x81,
+    0xf0, 0x07, 0x44, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x81, 0xf0, 0x07, 0x44, 0xff, 0x80, 0xf0,
+    0x49, 0xff, 0x81, 0xf8, 0x0f, 0x44, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x81, 0xf8, 0x1f, 0x44,
+    0xff, 0x80, 0xf0, 0x49, 0xff, 0x81, 0xf8, 0x1f, 0x44, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x81,
+    0xfc, 0x3f, 0x44, 0xff, 0x80, 0xf0, 0x49, 0xff, 0x81, 0xfe, 0x3f, 0x44, 0xff, 0x80, 0xf0,
+    0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80,
+    0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff,
+    0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x50,
+    0xff, 0x80, 0xf0, 0x50, 0xff, 0x80, 0xf0, 0x3f, 0x3f, 0x3f, 0x1f, 0x80, 0x07, 0x10, 0x81,
+    0x07, 0xc0, 0x0f, 0x81, 0x07, 0xe0, 0x0f, 0x81, 0x07, 0xf8, 0x0f, 0x81, 0x07, 0xfc, 0x0f,
+    0x81, 0x0f, 0xfe, 0x0f, 0x81, 0x07, 0xfe, 0x0f, 0x81, 0x07, 0xff, 0x0f, 0x81, 0x03, 0xff,
+    0x0f, 0x81, 0x01, 0xff, 0x10, 0x80, 0xff, 0x10, 0x80, 0xff, 0x10, 0x80, 0xff, 0x10, 0x80,
+    0xfe, 0x10, 0x80, 0xfe, 0x10, 0x80, 0xfe, 0x10, 0x80, 0x7c, 0x10, 0x80, 0x3c, 0x10, 0x80,
+    0x3c, 0x10, 0x80, 0x3c, 0x0f, 0x81, 0x02, 0xfc, 0x0f, 0x82, 0x03, 0xf8, 0x60, 0x0e, 0x82,
+    0x01, 0xf8, 0x78, 0x0e, 0x82, 0x01, 0xf8, 0x7c, 0x0e, 0x82, 0x01, 0xf0, 0xfc, 0x0e, 0x82,
+    0x01, 0xe0, 0x38, 0x0f, 0x81, 0xe0, 0x1e, 0x0f, 0x81, 0xc0, 0x7f, 0x0f, 0x82, 0x80, 0x7f,
+    0x80, 0x0d, 0x83, 0x05, 0x80, 0x7f, 0xc0, 0x0d, 0x83, 0x0e, 0x00, 0x0f, 0xe0, 0x0d, 0x83,
+    0x0c, 0x00, 0x07, 0xe0, 0x0d, 0x83, 0x18, 0x00, 0x0f, 0xf0, 0x0d, 0x83, 0x10, 0x00, 0x0f,
+    0xf0, 0x0d, 0x83, 0x30, 0x00, 0x0f, 0xf0, 0x0d, 0x83, 0x20, 0x00, 0x0f, 0xf8, 0x0d, 0x83,
+    0x03, 0x00, 0x0f, 0xf8, 0x0d, 0x83, 0x6f, 0x00, 0x0f, 0xf8, 0x0d, 0x83, 0x7f, 0x00, 0x07,
+    0xf0, 0x0d, 0x83, 0x6e, 0x00, 0x07, 0xe0, 0x0d, 0x83, 0x6c, 0x00, 0x07, 0xe0, 0x0d, 0x83,
+    0x70, 0x00, 0x03, 0xc0, 0x0d, 0x83, 0x30, 0x00, 0x01, 0xe0, 0x0d, 0x80, 0x38, 0x01, 0x80,
+    0x20, 0x0d, 0x80, 0x38, 0x01, 0x80, 0x60, 0x0d, 0x80, 0x19, 0x10, 0x81, 0x01, 0x80, 0x0f,
+    0x82, 0x06, 0x00, 0xc0, 0x0e, 0x82, 0x06, 0x00, 0x80, 0x0e, 0x81, 0x07, 0x80, 0x0f, 0x81,
+    0x07, 0xc0, 0x10, 0x80, 0x80, 0x3f, 0x0f, 0x3f, 0x3f, 0x17, 0x80, 0x06, 0x0f, 0x80, 0x38,
+    0x0f, 0x81, 0x06, 0x10, 0x0f, 0x80, 0x0c, 0x12, 0x80, 0x07, 0x10, 0x81, 0x07, 0xc0, 0x0f,
+    0x81, 0x07, 0xe0, 0x0d, 0x83, 0x01, 0x80, 0x07, 0xf8, 0x0f, 0x81, 0x07, 0xfc, 0x0f, 0x81,
+    0x0f, 0xfe, 0x0f, 0x81, 0x07, 0xfe, 0x0d, 0x83, 0x80, 0x00, 0x07, 0xff, 0x0c, 0x84, 0x01,
+    0x91, 0x00, 0x03, 0xff, 0x0c, 0x84, 0x03, 0x90, 0x00, 0x01, 0xff, 0x0c, 0x81, 0x03, 0x80,
+    0x01, 0x80, 0xff, 0x0c, 0x80, 0x03, 0x02, 0x80, 0xff, 0x10, 0x80, 0xff, 0x10, 0x80, 0xfe,
+    0x0d, 0x80, 0x20, 0x01, 0x80, 0xfe, 0x0d, 0x80, 0x60, 0x01, 0x80, 0xfe, 0x0c, 0x80, 0x03,
+    0x02, 0x80, 0x7c, 0x0c, 0x80, 0x03, 0x02, 0x80, 0x3c, 0x0c, 0x80, 0x06, 0x01, 0x81, 0x18,
+    0x3c, 0x0f, 0x81, 0x7f, 0x3c, 0x0f, 0x81, 0xfe, 0xfc, 0x0e, 0x82, 0x01, 0xff, 0x7c, 0x0e,
+    0x82, 0x03, 0xfe, 0x78, 0x0e, 0x82, 0x07, 0xfe, 0x78, 0x0e, 0x82, 0x07, 0xfe, 0xf0, 0x0d,
+    0x83, 0x10, 0x07, 0xc7, 0xe0, 0x0d, 0x83, 0x10, 0x07, 0x80, 0xe0, 0x0d, 0x83, 0x10, 0x07,
+    0x00, 0xc0, 0x0d, 0x83, 0x10, 0x07, 0x00, 0x80, 0x0d, 0x83, 0x10, 0x07, 0x85, 0x80, 0x0d,
+    0x82, 0x09, 0xc7, 0x0e, 0x0e, 0x82, 0x07, 0xe7, 0x0c, 0x0e, 0x82, 0x01, 0xee, 0x18, 0x0f,
+    0x81, 0x70, 0x10, 0x10, 0x80, 0x30, 0x10, 0x80, 0x20, 0x10, 0x80, 0x03, 0x10, 0x80, 0x6f,
+    0x10, 0x80, 0x7f, 0x10, 0x80, 0x6e, 0x10, 0x80, 0x6c, 0x10, 0x80, 0x70, 0x10, 0x80, 0x30,
+    0x01, 0x80, 0x20, 0x0d, 0x80, 0x38, 0x01, 0x80, 0x20, 0x0d, 0x80, 0x38, 0x01, 0x80, 0x60,
+    0x0d, 0x80, 0x19, 0x10, 0x81, 0x01, 0x80, 0x0f, 0x82, 0x06, 0x00, 0xc0, 0x0e, 0x82, 0x06,
+    0x00, 0x80, 0x0e, 0x81, 0x07, 0x80, 0x0f, 0x81, 0x07, 0xc0, 0x10, 0x80, 0x80, 0x3f, 0x0f,
+    0x3f, 0x3f, 0x17, 0x80, 0x06, 0x0f, 0x80, 0x38, 0x0f, 0x81, 0x06, 0x10, 0x0f, 0x80, 0x0c,
+    0x26, 0x81, 0x03, 0x80, 0x0f, 0x80, 0x17, 0x0c, 0x81, 0x01, 0x80, 0x01, 0x80, 0x3e, 0x0f,
+    0x81, 0x01, 0xfe, 0x0f, 0x81, 0x01, 0xfc, 0x0f, 0x81, 0x03, 0xfc, 0x0c, 0x80, 0x80, 0x01,
+    0x81, 0x07, 0xf8, 0x0b, 0x81, 0x01, 0x91, 0x01, 0x81, 0x0f, 0xf8, 0x0b, 0x81, 0x03, 0x90,
+    0x01, 0x81, 0x1f, 0xf0, 0x0b, 0x81, 0x03, 0x80, 0x01, 0x81, 0x3f, 0xe0, 0x0b, 0x80, 0x03,
+    0x02, 0x81, 0x3f, 0x80, 0x0f, 0x81, 0x3f, 0x80, 0x0f, 0x80, 0x7f, 0x0d, 0x80, 0x20, 0x01,
+    0x80, 0x7f, 0x0d, 0x83, 0x60, 0x03, 0x80, 0x7e, 0x0c, 0x84, 0x03, 0x00, 0x2f, 0xe0, 0x7f,
+    0x0c, 0x84, 0x03, 0x00, 0x1c, 0xe0, 0x3f, 0x0c, 0x80, 0x06, 0x01, 0x82, 0x78, 0x7f, 0x20,
+    0x0e, 0x82, 0x1f, 0xff, 0x60, 0x0d, 0x83, 0x01, 0x1e, 0x7f, 0xe0, 0x0d, 0x83, 0x3e, 0x3c,
+    0x7f, 0xf8, 0x0d, 0x83, 0x7c, 0x60, 0x7f, 0xf8, 0x0d, 0x83, 0xf9, 0x80, 0x7f, 0xe0, 0x0c,
+    0x84, 0x01, 0xff, 0x03, 0xff, 0x60, 0x0c, 0x84, 0x11, 0xf6, 0x3e, 0x7f, 0x30, 0x0c, 0x83,
+    0x13, 0xf6, 0x70, 0x3f, 0x0d, 0x83, 0x13, 0xf6, 0xf0, 0x3f, 0x0d, 0x83, 0x13, 0xfe, 0xf0,
+    0x7f, 0x0d, 0x83, 0x11, 0xfa, 0x70, 0x3f, 0x0d, 0x84, 0x08, 0x38, 0xf0, 0x3f, 0x80, 0x0c,
+    0x84, 0x06, 0x18, 0xf0, 0x3f, 0xc0, 0x0c, 0x84, 0x01, 0x11, 0xe0, 0x1f, 0xe0, 0x0d, 0x83,
+    0x8f, 0xc0, 0x1f, 0xf0, 0x0d, 0x83, 0x7f, 0x80, 0x0f, 0xf8, 0x0d, 0x83, 0x0f, 0x00, 0x07,
+    0xfc, 0x0f, 0x81, 0x03, 0xfc, 0x0f, 0x81, 0x01, 0xfe, 0x10, 0x80, 0xfe, 0x10, 0x80, 0x7e,
+    0x10, 0x80, 0x1f, 0x10, 0x80, 0x03, 0x10, 0x81, 0x01, 0x80, 0x3f, 0x3f, 0x3f, 0x2f, 0x3f,
+    0x3f, 0x3f, 0x21, 0x80, 0x04, 0x10, 0x81, 0x0f, 0x80, 0x0f, 0x80, 0x1b, 0x10, 0x80, 0x20,
+    0x0f, 0x81, 0x01, 0xc0, 0x0f, 0x81, 0x01, 0x82, 0x0f, 0x81, 0x03, 0x02, 0x0f, 0x81, 0x07,
+    0x06, 0x0d, 0x83, 0x03, 0xff, 0xf0, 0x06, 0x0d, 0x83, 0x07, 0xff, 0xe0, 0x0e, 0x0d, 0x83,
+    0x0e, 0x00, 0x3c, 0x1c, 0x0d, 0x83, 0x18, 0x00, 0x38, 0x78, 0x0d, 0x83, 0x30, 0x00, 0x30,
+    0x70, 0x0d, 0x83, 0xe0, 0x00, 0x60, 0xe0, 0x0c, 0x84, 0x01, 0xc0, 0xc0, 0x60, 0xe0, 0x0c,
+    0x84, 0x01, 0x9c, 0x60, 0x61, 0xe0, 0x0c, 0x84, 0x01, 0x21, 0x10, 0x60, 0xe0, 0x0c, 0x84,
+    0x03, 0x1c, 0xd0, 0x30, 0xe0, 0x0c, 0x84, 0x02, 0x00, 0x50, 0x60, 0xd8, 0x0c, 0x84, 0x02,
+    0x00, 0x10, 0xc0, 0x98, 0x0d, 0x83, 0x01, 0x81, 0x80, 0x18, 0x0c, 0x84, 0x04, 0x3f, 0x20,
+    0x00, 0x06, 0x0d, 0x83, 0x7e, 0x78, 0x00, 0x06, 0x0d, 0x83, 0xf9, 0xf0, 0x00, 0x18, 0x0c,
+    0x84, 0x05, 0xf7, 0x63, 0xc0, 0x98, 0x0c, 0x84, 0x03, 0xee, 0xe6, 0x70, 0xc8, 0x0c, 0x84,
+    0x01, 0xee, 0xee, 0x30, 0xf0, 0x0d, 0x83, 0xee, 0xef, 0x30, 0xe0, 0x0c, 0x84, 0x02, 0xe6,
+    0xef, 0x70, 0xe0, 0x0d, 0x83, 0x62, 0x7f, 0xb0, 0xf0, 0x0c, 0x84, 0x01, 0x00, 0x0f, 0xb0,
+    0x78, 0x0c, 0x84, 0x01, 0x80, 0x0f, 0xb8, 0x38, 0x0d, 0x83, 0xe0, 0x1f, 0x1c, 0x1c, 0x0d,
+    0x83, 0xf0, 0x3f, 0x1e, 0x0e, 0x0d, 0x83, 0x78, 0x7f, 0xf0, 0x07, 0x0d, 0x83, 0x0c, 0xff,
+    0xf8, 0x03, 0x0d, 0x83, 0x01, 0xff, 0xfc, 0x83, 0x0f, 0x81, 0x01, 0xc1, 0x10, 0x80, 0xe1,
+    0x10, 0x80, 0x60, 0x10, 0x80, 0x11, 0x10, 0x80, 0x0f, 0x10, 0x81, 0x0d, 0x80, 0x3f, 0x3f,
+    0x3f, 0x2f, 0x3f, 0x3f, 0x3f, 0x21, 0x80, 0x04, 0x10, 0x80, 0x0c, 0x10, 0x80, 0x0c, 0x10,
+    0x80, 0x1e, 0x10, 0x80, 0x3e, 0x10, 0x81, 0x7e, 0x20, 0x0f, 0x81, 0xfe, 0x60, 0x0c, 0x84,
+    0x01, 0xf5, 0x40, 0xfe, 0x40, 0x0f, 0x81, 0xfc, 0xc0, 0x0f, 0x81, 0x75, 0xc0, 0x0e, 0x82,
+    0x02, 0x73, 0xc0, 0x0e, 0x82, 0x07, 0x27, 0x80, 0x0c, 0x84, 0x40, 0x00, 0x0d, 0x0f, 0xc0,
+    0x0b, 0x85, 0x01, 0x10, 0x00, 0x10, 0x1f, 0x80, 0x0c, 0x84, 0x38, 0xc0, 0x00, 0x1f, 0x80,
+    0x0c, 0x83, 0x13, 0xe0, 0x00, 0x1e, 0x0d, 0x83, 0x8a, 0xf0, 0x60, 0x10, 0x0d, 0x83, 0x04,
+    0x30, 0x30, 0xd0, 0x0d, 0x83, 0x04, 0x30, 0x21, 0x88, 0x0d, 0x83, 0x0c, 0x70, 0xa3, 0x48,
+    0x0c, 0x84, 0x04, 0x0c, 0x63, 0x9e, 0x60, 0x0d, 0x83, 0x0c, 0xe4, 0x03, 0x06, 0x0d, 0x83,
+    0x19, 0xd8, 0x02, 0x06, 0x0d, 0x83, 0x1f, 0xfc, 0x06, 0xe0, 0x0d, 0x83, 0x37, 0xee, 0xb3,
+    0x48, 0x0d, 0x83, 0x27, 0x6e, 0x11, 0x88, 0x0d, 0x83, 0x67, 0xee, 0x31, 0xc0, 0x0d, 0x82,
+    0x67, 0x67, 0x70, 0x0e, 0x83, 0xe7, 0x61, 0x10, 0x1e, 0x0d, 0x84, 0x67, 0x91, 0x90, 0x0f,
+    0x80, 0x0c, 0x84, 0x01, 0xf1, 0x90, 0x07, 0x80, 0x0d, 0x83, 0x11, 0x8c, 0x07, 0xc0, 0x0c,
+    0x84, 0x20, 0x11, 0x00, 0x03, 0xc0, 0x0c, 0x84, 0x10, 0x11, 0x00, 0x75, 0xe0, 0x0c, 0x80,
+    0x08, 0x01, 0x81, 0x7a, 0xe0, 0x0c, 0x80, 0x04, 0x01, 0x81, 0xff, 0x30, 0x0c, 0x80, 0x02,
+    0x01, 0x81, 0x7f, 0x10, 0x0f, 0x80, 0x3f, 0x10, 0x80, 0x1f, 0x10, 0x80, 0x1e, 0x10, 0x80,
+    0x0e, 0x10, 0x80, 0x0c, 0x10, 0x80, 0x0c, 0x3f, 0x3f, 0x3f, 0x30, 0x3f, 0x3f, 0x3f, 0x3f,
+    0x29, 0x80, 0x02, 0x10, 0x81, 0x06, 0x20, 0x0f, 0x81, 0x2c, 0x60, 0x0c, 0x84, 0x01, 0xf5,
+    0x40, 0x5c, 0x40, 0x0f, 0x81, 0xfa, 0xc0, 0x0f, 0x81, 0x73, 0xc0, 0x0e, 0x82, 0x1e, 0x77,
+    0xc0, 0x0b, 0x80, 0x10, 0x01, 0x82, 0x7f, 0x2f, 0x80, 0x0b, 0x85, 0x08, 0x40, 0x00, 0x7d,
+    0x0f, 0xc0, 0x0b, 0x85, 0x06, 0x10, 0x01, 0xf0, 0x3f, 0x80, 0x0c, 0x84, 0x38, 0x01, 0xe1,
+    0xbf, 0x80, 0x0c, 0x83, 0x4c, 0x01, 0xe3, 0x9e, 0x0d, 0x83, 0xc4, 0x03, 0x8f, 0x90, 0x0d,
+    0x83, 0x44, 0x03, 0xcf, 0x10, 0x0d, 0x83, 0x44, 0x01, 0xde, 0x40, 0x0d, 0x83, 0xcc, 0x04,
+    0x78, 0xa0, 0x0c, 0x84, 0x04, 0xcc, 0x1c, 0xed, 0x80, 0x0c, 0x84, 0x01, 0x8c, 0x38, 0x1f,
+    0xe0, 0x0c, 0x84, 0x03, 0x99, 0x80, 0x1a, 0xe0, 0x0c, 0x83, 0x07, 0x9b, 0xac, 0x31, 0x0d,
+    0x84, 0x03, 0x3f, 0xf7, 0xea, 0x80, 0x0c, 0x84, 0x05, 0x3f, 0xf1, 0xfc, 0x40, 0x0c, 0x84,
+    0x0d, 0x77, 0xf3, 0xce, 0x10, 0x0c, 0x84, 0x0c, 0xff, 0x7b, 0x8f, 0x80, 0x0c, 0x84, 0x0e,
+    0x7f, 0xbf, 0xe3, 0x9e, 0x0c, 0x85, 0x06, 0x1b, 0xdf, 0xe1, 0xbf, 0x80, 0x0b, 0x85, 0x07,
+    0x0d, 0xce, 0xe0, 0x3f, 0x80, 0x0b, 0x85, 0x07, 0x84, 0x6e, 0xf4, 0x0f, 0xc0, 0x0b, 0x85,
+    0x03, 0xc4, 0x6e, 0x7c, 0x0f, 0xc0, 0x0b, 0x85, 0x01, 0xe0, 0x6e, 0x2e, 0x73, 0xe0, 0x0c,
+    0x80, 0xf0, 0x01, 0x81, 0x7d, 0xe0, 0x0c, 0x80, 0x78, 0x01, 0x81, 0xf8, 0x30, 0x0c, 0x80,
+    0x03, 0x01, 0x81, 0x7c, 0x10, 0x0f, 0x80, 0x2c, 0x10, 0x80, 0x06, 0x10, 0x80, 0x02, 0x3f,
+    0x3f, 0x3f, 0x3f, 0x26, 0x3f, 0x3f, 0x3f, 0x3f, 0x29, 0x80, 0x02, 0x10, 0x80, 0x06, 0x10,
+    0x80, 0x2c, 0x10, 0x80, 0x5c, 0x0d, 0x83, 0x03, 0xff, 0xff, 0xf8, 0x0d, 0x83, 0x07, 0xff,
+    0xff, 0xf8, 0x0d, 0x83, 0x0e, 0x00, 0x1f, 0xf8, 0x0c, 0x84, 0x10, 0x19, 0xff, 0x7f, 0xf0,
+    0x0c, 0x84, 0x08, 0x37, 0xff, 0xff, 0xf0, 0x0c, 0x84, 0x07, 0xe3, 0xfe, 0xff, 0xc0, 0x0c,
+    0x84, 0x01, 0xc7, 0xff, 0xfe, 0x40, 0x0c, 0x84, 0x01, 0xcf, 0xf9, 0xfc, 0x60, 0x0c, 0x84,
+    0x01, 0x5f, 0xfb, 0xf0, 0x60, 0x0c, 0x84, 0x03, 0x7b, 0xf3, 0xf0, 0x20, 0x0c, 0x84, 0x02,
+    0x47, 0xf1, 0xe0, 0x30, 0x0c, 0x84, 0x02, 0xcf, 0xfc, 0xe4, 0x10, 0x0c, 0x84, 0x02, 0xff,
+    0xe7, 0x0c, 0x18, 0x0c, 0x84, 0x0a, 0x7f, 0xc3, 0xe3, 0x18, 0x0c, 0x84, 0x0c, 0x7e, 0x41,
+    0xe7, 0x18, 0x0c, 0x84, 0x06, 0x7c, 0x27, 0xc8, 0x18, 0x0c, 0x84, 0x07, 0x18, 0x7e, 0x66,
+    0x30, 0x0c, 0x84, 0x07, 0x00, 0x71, 0xe2, 0x30, 0x0c, 0x84, 0x0f, 0x3c, 0xf3, 0xf0, 0x20,
+    0x0c, 0x84, 0x0f, 0x98, 0xf3, 0xf0, 0x60, 0x0c, 0x84, 0x0f, 0x88, 0x39, 0xfc, 0x60, 0x0c,
+    0x84, 0x07, 0xe4, 0x3d, 0xfe, 0x40, 0x0c, 0x84, 0x07, 0xf0, 0x3f, 0xff, 0xc0, 0x0c, 0x84,
+    0x07, 0xfa, 0x7f, 0xff, 0xf0, 0x0c, 0x84, 0x03, 0xf8, 0x7f, 0xff, 0xf0, 0x0c, 0x84, 0x01,
+    0xff, 0x9f, 0x2f, 0xf8, 0x0d, 0x42, 0xff, 0x80, 0xf8, 0x0d, 0x83, 0x7f, 0xff, 0xff, 0xf8,
+    0x0e, 0x82, 0xff, 0xff, 0x7c, 0x10, 0x80, 0x2c, 0x10, 0x80, 0x06, 0x10, 0x80, 0x02, 0x3f,
+    0x3f, 0x3f, 0x3f, 0x26, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x14, 0x80, 0x02, 0x0e, 0x82,
+    0x01, 0xff, 0x07, 0x0e, 0x83, 0x07, 0xff, 0xbf, 0x80, 0x0d, 0x83, 0x02, 0x00, 0xfc, 0xc0,
+    0x0d, 0x83, 0x04, 0x01, 0xfc, 0x40, 0x0d, 0x83, 0x08, 0x07, 0xff, 0x20, 0x0d, 0x83, 0x18,
+    0x07, 0xff, 0xe0, 0x0d, 0x83, 0x34, 0x0f, 0x87, 0xe0, 0x0d, 0x83, 0x08, 0x0c, 0x03, 0xf0,
+    0x0d, 0x83, 0x08, 0x00, 0x01, 0xf3, 0x0c, 0x85, 0x02, 0x3c, 0x04, 0x00, 0xf7, 0xe0, 0x0b,
+    0x85, 0x0f, 0xfc, 0x02, 0x00, 0xff, 0xc0, 0x0b, 0x81, 0x0f, 0xf0, 0x01, 0x80, 0x7f, 0x0c,
+    0x84, 0x01, 0xf0, 0x07, 0x00, 0x7f, 0x0d, 0x83, 0x10, 0x07, 0x00, 0x7f, 0x0d, 0x83, 0x08,
+    0x0f, 0x00, 0x7f, 0x0d, 0x83, 0x34, 0x0f, 0x00, 0x3f, 0x0d, 0x83, 0x18, 0x0f, 0x00, 0x1e,
+    0x0d, 0x81, 0x0c, 0x07, 0x0f, 0x81, 0x06, 0x02, 0x0f, 0x81, 0x03, 0x83, 0x0f, 0x81, 0x01,
+    0xff, 0x0f, 0x82, 0x03, 0xff, 0x80, 0x0f, 0x80, 0x1f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+    0x14, 0x3f, 0x3f, 0x3f, 0x10, 0x80, 0x60, 0x10, 0x80, 0x20, 0x10, 0x80, 0x20, 0x10, 0x80,
+    0x40, 0x10, 0x80, 0x40, 0x0f, 0x81, 0x20, 0x40, 0x0f, 0x81, 0x20, 0x40, 0x0e, 0x82, 0x04,
+    0x30, 0x80, 0x0e, 0x82, 0x12, 0x70, 0x80, 0x0d, 0x83, 0x01, 0x62, 0x70, 0x80, 0x0d, 0x83,
+    0x07, 0x82, 0x70, 0x80, 0x0d, 0x82, 0x1e, 0x01, 0xf1, 0x0e, 0x82, 0x78, 0x04, 0xf9, 0x0e,
+    0x82, 0xf0, 0x38, 0x71, 0x0d, 0x83, 0x02, 0x3f, 0xfb, 0x30, 0x0d, 0x83, 0x0c, 0xff, 0xf3,
+    0xb0, 0x0d, 0x83, 0x1b, 0xff, 0xe0, 0xd0, 0x0d, 0x83, 0x7f, 0xf7, 0xe0, 0x10, 0x0c, 0x84,
+    0x01, 0xef, 0xdb, 0xb8, 0x10, 0x0c, 0x85, 0x03, 0x8f, 0xc2, 0x3c, 0x00, 0xc0, 0x0b, 0x84,
+    0x0f, 0x07, 0xe6, 0x7e, 0x0c, 0x0c, 0x85, 0x3c, 0x03, 0xc3, 0xff, 0x09, 0xe0, 0x0b, 0x85,
+    0xf0, 0x02, 0x01, 0xff, 0x01, 0xc0, 0x0b, 0x84, 0x3c, 0x0e, 0x01, 0xff, 0x81, 0x0c, 0x84,
+    0x1e, 0x0f, 0xc0, 0xff, 0x80, 0x0c, 0x85, 0x07, 0x8f, 0xc0, 0x7f, 0x84, 0x80, 0x0b, 0x84,
+    0x01, 0xef, 0xc1, 0x3f, 0x8f, 0x0d, 0x83, 0xff, 0xb3, 0x3f, 0xcf, 0x0d, 0x83, 0x3b, 0xf7,
+    0x1f, 0xee, 0x0d, 0x83, 0x0c, 0xff, 0x1f, 0xf0, 0x0d, 0x83, 0x02, 0x3e, 0x0f, 0xf2, 0x0d,
+    0x83, 0x01, 0x9c, 0x03, 0xf1, 0x0e, 0x82, 0x78, 0x03, 0xf1, 0x0e, 0x82, 0x1e, 0x03, 0xf1,
+    0x0e, 0x82, 0x07, 0x02, 0x71, 0x0e, 0x83, 0x03, 0x40, 0x70, 0x80, 0x0e, 0x82, 0x30, 0x60,
+    0x80, 0x0e, 0x82, 0x08, 0x60, 0x80, 0x0f, 0x81, 0x60, 0xc0, 0x0f, 0x81, 0x60, 0x40, 0x10,
+    0x80, 0x40, 0x10, 0x80, 0x40, 0x10, 0x80, 0x20, 0x10, 0x80, 0x20, 0x10, 0x80, 0x60, 0x10,
+    0x80, 0x30, 0x3f, 0x3f, 0x3f, 0x0b, 0x3f, 0x3f, 0x3f, 0x10, 0x80, 0x10, 0x34, 0x80, 0x20,
+    0x10, 0x80, 0x20, 0x0f, 0x80, 0x20, 0x10, 0x81, 0x20, 0x80, 0x0f, 0x81, 0x31, 0x40, 0x0e,
+    0x81, 0x0a, 0x76, 0x0e, 0x82, 0x02, 0x83, 0x7c, 0x0e, 0x82, 0x08, 0x03, 0x69, 0x0e, 0x82,
+    0x01, 0x00, 0xc8, 0x0e, 0x82, 0x04, 0x04, 0x80, 0x0d, 0x81, 0x01, 0x08, 0x10, 0x82, 0x20,
+    0x08, 0x03, 0x0e, 0x82, 0x80, 0x30, 0x10, 0x0d, 0x83, 0x22, 0x00, 0x20, 0x30, 0x0d, 0x83,
+    0x84, 0x08, 0x64, 0x70, 0x0d, 0x83, 0x10, 0x38, 0x46, 0xb0, 0x0c, 0x85, 0x04, 0x40, 0x22,
+    0xc5, 0xb1, 0xc0, 0x0b, 0x80, 0x10, 0x01, 0x81, 0x84, 0x33, 0x0c, 0x84, 0x02, 0x00, 0x40,
+    0x08, 0x06, 0x0c, 0x84, 0x0c, 0x02, 0x00, 0x1e, 0x0e, 0x0c, 0x84, 0x40, 0x02, 0x02, 0x06,
+    0x0e, 0x0c, 0x80, 0x01, 0x01, 0x81, 0x08, 0x03, 0x0c, 0x85, 0x08, 0x40, 0x21, 0x84, 0x39,
+    0x80, 0x0b, 0x84, 0x02, 0x00, 0x02, 0xc4, 0xb0, 0x0e, 0x82, 0x68, 0x46, 0x70, 0x0d, 0x83,
+    0x02, 0x0c, 0x64, 0x30, 0x0d, 0x83, 0x10, 0x00, 0x20, 0x32, 0x0d, 0x80, 0x04, 0x01, 0x80,
+    0x11, 0x0e, 0x82, 0x10, 0x0c, 0x12, 0x0f, 0x80, 0x05, 0x0f, 0x82, 0x20, 0x00, 0x88, 0x0e,
+    0x83, 0x08, 0x83, 0x48, 0x80, 0x0e, 0x81, 0x80, 0x6d, 0x0f, 0x81, 0x80, 0x66, 0x0f, 0x82,
+    0x04, 0x63, 0x40, 0x0f, 0x80, 0x61, 0x10, 0x81, 0x60, 0x80, 0x22, 0x80, 0x20, 0x10, 0x80,
+    0x40, 0x34, 0x80, 0x40, 0x10, 0x80, 0x10, 0x3f, 0x3f, 0x39, 0x3f, 0x3f, 0x3f, 0x3f, 0x18,
+    0x80, 0x20, 0x21, 0x81, 0x04, 0x80, 0x0f, 0x80, 0x19, 0x0f, 0x81, 0x04, 0x36, 0x0f, 0x81,
+    0x05, 0x6c, 0x0e, 0x82, 0x08, 0x0d, 0xf8, 0x0f, 0x81, 0x0e, 0xf8, 0x0f, 0x81, 0x1c, 0xb8,
+    0x0e, 0x82, 0x08, 0x18, 0x30, 0x0e, 0x82, 0x20, 0x30, 0x71, 0x0f, 0x81, 0xc0, 0x60, 0x0f,
+    0x81, 0xc0, 0xc0, 0x0d, 0x83, 0x84, 0x01, 0x95, 0x80, 0x0e, 0x82, 0xdd, 0x9c, 0x40, 0x0e,
+    0x82, 0xef, 0x13, 0x45, 0x0e, 0x82, 0x6d, 0x14, 0xfc, 0x0c, 0x84, 0x02, 0x01, 0x80, 0x28,
+    0x18, 0x0c, 0x84, 0x04, 0x04, 0x00, 0x66, 0x30, 0x0d, 0x83, 0x0c, 0x0a, 0x1e, 0x30, 0x0e,
+    0x82, 0xc0, 0x28, 0x0c, 0x0c, 0x84, 0x08, 0x40, 0x6d, 0x14, 0xca, 0x0e, 0x82, 0xcf, 0x16,
+    0x40, 0x0e, 0x82, 0x25, 0x9f, 0x80, 0x0e, 0x82, 0x25, 0x94, 0xc0, 0x0f, 0x81, 0xc0, 0xc0,
+    0x0f, 0x81, 0x30, 0x60, 0x0f, 0x81, 0x30, 0x60, 0x0f, 0x81, 0x19, 0x70, 0x0f, 0x81, 0x0a,
+    0xb8, 0x0f, 0x81, 0x09, 0xf8, 0x0f, 0x81, 0x04, 0x7c, 0x0f, 0x81, 0x80, 0x36, 0x10, 0x80,
+    0x13, 0x10, 0x80, 0x09, 0x10, 0x81, 0x04, 0x80, 0x3f, 0x3f, 0x3f, 0x3f, 0x37, 0x3f, 0x3f,
+    0x3f, 0x10, 0x80, 0x70, 0x10, 0x80, 0x20, 0x10, 0x80, 0x20, 0x10, 0x80, 0x60, 0x10, 0x80,
+    0x40, 0x0f, 0x81, 0x04, 0x40, 0x0f, 0x81, 0x04, 0x40, 0x0e, 0x82, 0x04, 0x10, 0xc0, 0x0e,
+    0x82, 0x1c, 0x28, 0x80, 0x0d, 0x83, 0x03, 0xe6, 0x50, 0x80, 0x0d, 0x83, 0x07, 0x8e, 0x91,
+    0x80, 0x0d, 0x82, 0x1f, 0x0f, 0xb1, 0x0e, 0x82, 0x7c, 0x1d, 0x31, 0x0d, 0x83, 0x01, 0xf0,
+    0x18, 0x31, 0x0d, 0x83, 0x03, 0xc0, 0x30, 0x62, 0x0d, 0x83, 0x0f, 0x80, 0xe0, 0x60, 0x0d,
+    0x83, 0x3e, 0x00, 0xc0, 0xc0, 0x0d, 0x83, 0x78, 0x01, 0xd1, 0xc0, 0x0c, 0x84, 0x01, 0xf0,
+    0xe9, 0x99, 0xa0, 0x0c, 0x84, 0x07, 0xc0, 0xcf, 0x96, 0x44, 0x0c, 0x84, 0x1f, 0x00, 0x6f,
+    0x12, 0xde, 0x0c, 0x84, 0x3c, 0x01, 0xc1, 0x24, 0x1c, 0x0c, 0x84, 0xf8, 0x06, 0x02, 0x77,
+    0x30, 0x0c, 0x84, 0x7c, 0x0c, 0x08, 0x18, 0x38, 0x0c, 0x84, 0x1f, 0x00, 0xc1, 0x2c, 0x0c,
+    0x0c, 0x84, 0x07, 0x80, 0x4d, 0x12, 0x6a, 0x0c, 0x84, 0x03, 0xe0, 0xcf, 0x91, 0xa0, 0x0d,
+    0x83, 0xf8, 0x49, 0x9b, 0x80, 0x0d, 0x83, 0x3e, 0x21, 0xd4, 0xc0, 0x0d, 0x83, 0x1f, 0x00,
+    0xf0, 0xe2, 0x0d, 0x83, 0x07, 0xc0, 0x30, 0x63, 0x0d, 0x83, 0x01, 0xf0, 0x38, 0x63, 0x0e,
+    0x82, 0x78, 0x18, 0x61, 0x0e, 0x82, 0x3e, 0x0b, 0xa1, 0x0e, 0x83, 0x0f, 0x8a, 0xb1, 0x80,
+    0x0d, 0x83, 0x03, 0xc4, 0x51, 0x80, 0x0e, 0x82, 0x30, 0x20, 0x80, 0x0e, 0x82, 0x0c, 0x08,
+    0xc0, 0x10, 0x80, 0xc0, 0x0f, 0x81, 0x04, 0x40, 0x10, 0x80, 0x40, 0x10, 0x80, 0x60, 0x10,
+    0x80, 0x60, 0x10, 0x80, 0x20, 0x10, 0x80, 0x60, 0x10, 0x80, 0x70, 0x10, 0x80, 0x10, 0x3f,
+    0x3f, 0x39, 0x3f, 0x3f, 0x3f, 0x3f, 0x29, 0x80, 0x04, 0x22, 0x80, 0x08, 0x10, 0x80, 0x18,
+    0x0f, 0x81, 0x02, 0x30, 0x0f, 0x81, 0x02, 0x70, 0x0f, 0x81, 0x02, 0x70, 0x0f, 0x81, 0x06,
+    0xf0, 0x0f, 0x81, 0x07, 0xf0, 0x0e, 0x82, 0x1f, 0xcf, 0xe0, 0x0e, 0x82, 0x3f, 0xdf, 0xe0,
+    0x0e, 0x82, 0x7f, 0xff, 0xc0, 0x0e, 0x82, 0xbf, 0xff, 0xc0, 0x0e, 0x82, 0x57, 0xfc, 0xa0,
+    0x0e, 0x82, 0xc3, 0xff, 0x40, 0x0e, 0x82, 0xe3, 0x7d, 0xee, 0x0d, 0x83, 0x21, 0xc1, 0x3b,
+    0xfc, 0x0d, 0x83, 0x32, 0x02, 0x10, 0xf0, 0x0d, 0x83, 0x38, 0x00, 0x0f, 0xf8, 0x0d, 0x83,
+    0x3f, 0xc1, 0x33, 0xfc, 0x0d, 0x83, 0x0f, 0xc1, 0xfd, 0x62, 0x0d, 0x83, 0x05, 0xc3, 0x7c,
+    0xa0, 0x0e, 0x82, 0xb7, 0xfd, 0x80, 0x0e, 0x82, 0x7f, 0xbb, 0xc0, 0x0e, 0x82, 0x1f, 0xcf,
+    0xe0, 0x0e, 0x82, 0x0f, 0xcf, 0xe0, 0x0e, 0x82, 0x03, 0xc7, 0xe0, 0x0f, 0x81, 0x07, 0xe0,
+    0x0f, 0x81, 0x02, 0x60, 0x0f, 0x81, 0x02, 0x70, 0x10, 0x80, 0x30, 0x10, 0x80, 0x10, 0x10,
+    0x80, 0x18, 0x10, 0x80, 0x08, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x0a, 0x3f, 0x3f, 0x17, 0x80,
+    0x06, 0x0f, 0x80, 0x38, 0x0f, 0x81, 0x06, 0x10, 0x0f, 0x80, 0x0c, 0x3f, 0x06, 0x81, 0x01,
+    0x80, 0x3f, 0x05, 0x80, 0x80, 0x0f, 0x81, 0x01, 0x91, 0x0f, 0x81, 0x03, 0x90, 0x0f, 0x81,
+    0x03, 0x80, 0x0f, 0x80, 0x03, 0x25, 0x81, 0x1f, 0xc0, 0x0d, 0x83, 0x20, 0x00, 0x3f, 0xc0,
+    0x0d, 0x83, 0x60, 0x00, 0x7f, 0xc0, 0x0c, 0x80, 0x03, 0x01, 0x81, 0xbf, 0xc0, 0x0c, 0x80,
+    0x03, 0x01, 0x81, 0x7f, 0x80, 0x0c, 0x80, 0x06, 0x01, 0x81, 0xe7, 0x80, 0x0f, 0x81, 0x80,
+    0x80, 0x0e, 0x82, 0x21, 0x00, 0x40, 0x0e, 0x82, 0x32, 0x00, 0x60, 0x0e, 0x82, 0x38, 0x00,
+    0x70, 0x0e, 0x82, 0x38, 0x00, 0x40, 0x0e, 0x80, 0x08, 0x0f, 0x82, 0x10, 0x02, 0x39, 0x0e,
+    0x83, 0x10, 0x07, 0x7f, 0x80, 0x0d, 0x83, 0x10, 0x07, 0x7f, 0x80, 0x0d, 0x83, 0x10, 0x07,
+    0x1f, 0xc0, 0x0d, 0x83, 0x10, 0x07, 0x8f, 0xc0, 0x0d, 0x83, 0x09, 0xc7, 0x03, 0xc0, 0x0d,
+    0x81, 0x07, 0xe7, 0x0f, 0x81, 0x01, 0xee, 0x10, 0x80, 0x70, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+    0x3f, 0x15, 0x2c, 0x80, 0x20, 0x10, 0x80, 0xfc, 0x0f, 0x82, 0x03, 0xff, 0x80, 0x0e, 0x82,
+    0x07, 0xff, 0xf8, 0x0e, 0x82, 0x0f, 0xff, 0xfc, 0x0e, 0x82, 0x0f, 0xf5, 0xf8, 0x0e, 0x82,
+    0x01, 0xc0, 0x78, 0x0d, 0x84, 0x38, 0x01, 0x80, 0x00, 0x20, 0x0b, 0x81, 0x06, 0x10, 0x0f,
+    0x80, 0x0c, 0x3f, 0x06, 0x81, 0x01, 0x80, 0x3f, 0x05, 0x80, 0x80, 0x0f, 0x81, 0x01, 0x91,
+    0x0f, 0x81, 0x03, 0x90, 0x0f, 0x81, 0x03, 0x80, 0x0f, 0x80, 0x03, 0x35, 0x80, 0x20, 0x10,
+    0x80, 0x60, 0x0f, 0x80, 0x03, 0x10, 0x80, 0x03, 0x10, 0x80, 0x06, 0x01, 0x80, 0x18, 0x10,
+    0x80, 0x7f, 0x02, 0x80, 0x10, 0x0c, 0x81, 0xff, 0x80, 0x01, 0x80, 0x1c, 0x0b, 0x82, 0x01,
+    0xff, 0x80, 0x01, 0x80, 0x3e, 0x0b, 0x82, 0x03, 0xff, 0x80, 0x01, 0x80, 0x3f, 0x0b, 0x82,
+    0x07, 0xff, 0x80, 0x01, 0x80, 0x3f, 0x0b, 0x81, 0x07, 0xff, 0x02, 0x80, 0x3f, 0x0a, 0x82,
+    0x10, 0x07, 0xc6, 0x02, 0x81, 0x3f, 0x80, 0x08, 0x83, 0x10, 0x10, 0x07, 0x80, 0x02, 0x81,
+    0x0f, 0x80, 0x09, 0x81, 0x10, 0x07, 0x03, 0x81, 0x0f, 0x80, 0x09, 0x81, 0x10, 0x07, 0x03,
+    0x81, 0x0f, 0x80, 0x09, 0x82, 0x10, 0x07, 0x80, 0x02, 0x80, 0x0f, 0x09, 0x82, 0x10, 0x09,
+    0xc7, 0x03, 0x80, 0x0f, 0x09, 0x82, 0x02, 0x07, 0xe7, 0x03, 0x80, 0x1e, 0x09, 0x82, 0x0f,
+    0x01, 0xee, 0x03, 0x80, 0x1e, 0x09, 0x82, 0x0f, 0x80, 0x70, 0x03, 0x80, 0x1c, 0x09, 0x81,
+    0x07, 0x80, 0x04, 0x80, 0x3c, 0x09, 0x81, 0x03, 0xc0, 0x04, 0x80, 0x3c, 0x09, 0x81, 0x03,
+    0xc0, 0x04, 0x80, 0x1c, 0x09, 0x81, 0x01, 0xe0, 0x0f, 0x81, 0x01, 0xf0, 0x0f, 0x81, 0x01,
+    0xff, 0x10, 0x81, 0xff, 0x80, 0x03, 0x80, 0x08, 0x0a, 0x81, 0xff, 0x80, 0x0f, 0x81, 0x7f,
+    0xc0, 0x03, 0x80, 0x40, 0x0a, 0x81, 0x1f, 0xc0, 0x0f, 0x81, 0x07, 0x80, 0x3f, 0x3f, 0x3f,
+    0x0f, 0x2c, 0x80, 0x20, 0x10, 0x80, 0xfc, 0x0f, 0x82, 0x03, 0xff, 0x80, 0x0e, 0x82, 0x07,
+    0xff, 0xf8, 0x0e, 0x82, 0x0f, 0xff, 0xfc, 0x0e, 0x82, 0x0f, 0xf5, 0xf8, 0x0e, 0x82, 0x07,
+    0xc0, 0x78, 0x0e, 0x83, 0x01, 0x80, 0x00, 0x20, 0x21, 0x80, 0x40, 0x10, 0x80, 0xc0, 0x0f,
+    0x81, 0x03, 0xd0, 0x0e, 0x82, 0x30, 0x03, 0xe0, 0x0e, 0x82, 0xe4, 0x07, 0xc0, 0x0d, 0x83,
+    0x07, 0xf8, 0x0f, 0xc0, 0x0d, 0x83, 0x0f, 0x80, 0x0f, 0xc0, 0x0d, 0x83, 0x1e, 0x00, 0x3f,
+    0x80, 0x0d, 0x83, 0x38, 0x00, 0x3f, 0x80, 0x0d, 0x83, 0x70, 0x00, 0x3f, 0xa0, 0x0d, 0x83,
+    0xe0, 0x00, 0x3f, 0x90, 0x0d, 0x83, 0xc0, 0x00, 0x7f, 0x88, 0x0c, 0x84, 0x01, 0x80, 0x00,
+    0x3f, 0x8c, 0x0c, 0x80, 0x03, 0x01, 0x81, 0x7f, 0x84, 0x0c, 0x80, 0x01, 0x01, 0x81, 0xff,
+    0x02, 0x0e, 0x82, 0x03, 0xff, 0x02, 0x0e, 0x82, 0x07, 0xfe, 0x03, 0x0d, 0x83, 0x20, 0x07,
+    0xfc, 0x01, 0x0c, 0x84, 0x01, 0xe0, 0x07, 0xfc, 0x01, 0x0c, 0x84, 0x03, 0xf8, 0x0f, 0xf8,
+    0x01, 0x0c, 0x86, 0x07, 0xfe, 0x07, 0xf1, 0x01, 0x80, 0x10, 0x0a, 0x86, 0x07, 0xff, 0x6f,
+    0xff, 0x81, 0x00, 0x1c, 0x0a, 0x86, 0x07, 0x7f, 0xff, 0xff, 0xc1, 0x80, 0x3e, 0x0a, 0x86,
+    0x07, 0x7f, 0xff, 0xff, 0xf9, 0x80, 0x3f, 0x0a, 0x86, 0x02, 0x47, 0xff, 0xff, 0xc1, 0x00,
+    0x3f, 0x0a, 0x86, 0x03, 0x03, 0xff, 0xf2, 0x01, 0x00, 0x3f, 0x0b, 0x86, 0x81, 0xef, 0xf8,
+    0x01, 0x00, 0x3f, 0x80, 0x08, 0x80, 0x10, 0x01, 0x85, 0x07, 0xfc, 0x01, 0x00, 0x0f, 0x80,
+    0x0b, 0x85, 0x07, 0xfe, 0x03, 0x00, 0x0f, 0x80, 0x0b, 0x85, 0x07, 0xff, 0x02, 0x00, 0x0f,
+    0x80, 0x09, 0x86, 0x01, 0x00, 0x01, 0xff, 0x02, 0x00, 0x0f, 0x09, 0x87, 0x10, 0x01, 0x80,
+    0x00, 0x7f, 0x84, 0x00, 0x0f, 0x09, 0x87, 0x02, 0x01, 0x80, 0x00, 0x7f, 0x8c, 0x00, 0x1e,
+    0x09, 0x87, 0x0f, 0x00, 0xc0, 0x00, 0x3f, 0x88, 0x00, 0x1e, 0x09, 0x87, 0x0f, 0x80, 0x60,
+    0x00, 0x3f, 0xd0, 0x00, 0x1c, 0x09, 0x87, 0x07, 0x80, 0x70, 0x00, 0x1f, 0xe0, 0x00, 0x3c,
+    0x09, 0x87, 0x03, 0xc0, 0x3c, 0x00, 0x1f, 0xc0, 0x00, 0x3c, 0x09, 0x87, 0x03, 0xc0, 0x1e,
+    0x00, 0x3f, 0xc0, 0x00, 0x1c, 0x09, 0x85, 0x01, 0xe0, 0x0f, 0xc0, 0x1f, 0xc0, 0x0b, 0x85,
+    0x01, 0xf0, 0x03, 0xfe, 0x0f, 0xc0, 0x0b, 0x85, 0x01, 0xff, 0x00, 0xe0, 0x07, 0xc0, 0x0c,
+    0x86, 0xff, 0x80, 0x10, 0x03, 0xc0, 0x00, 0x08, 0x0a, 0x84, 0xff, 0x80, 0x00, 0x03, 0xe0,
+    0x0c, 0x86, 0x7f, 0xc0, 0x00, 0x01, 0xa0, 0x00, 0x40, 0x0a, 0x81, 0x1f, 0xc0, 0x01, 0x80,
+    0x80, 0x0c, 0x81, 0x07, 0x80, 0x3f, 0x3f, 0x3f, 0x0f, 0x3f, 0x3f, 0x3f, 0x0f, 0x80, 0x40,
+    0x10, 0x80, 0xc0, 0x0f, 0x81, 0x03, 0xd0, 0x0f, 0x81, 0x03, 0xe0, 0x0d, 0x83, 0x01, 0x00,
+    0x07, 0xd0, 0x0e, 0x82, 0x04, 0x0e, 0xaf, 0x0e, 0x82, 0x40, 0x04, 0x1c, 0x0f, 0x81, 0x20,
+    0x7c, 0x0f, 0x81, 0x30, 0x73, 0x0f, 0x81, 0x40, 0x40, 0x1e, 0x80, 0x01, 0x01, 0x81, 0x40,
+    0x80, 0x0f, 0x81, 0x81, 0x80, 0x0d, 0x83, 0x80, 0x00, 0xc1, 0x80, 0x0e, 0x81, 0x01, 0x01,
+    0x0f, 0x81, 0x0e, 0x03, 0x0f, 0x81, 0x08, 0x06, 0x0e, 0x82, 0x20, 0x08, 0x0c, 0x0f, 0x81,
+    0x08, 0x1c, 0x0d, 0x83, 0x04, 0x08, 0x00, 0x18, 0x0d, 0x83, 0x04, 0x06, 0x18, 0x31, 0x0d,
+    0x85, 0x03, 0xc3, 0x60, 0x78, 0x80, 0x80, 0x0b, 0x83, 0x01, 0x01, 0xb0, 0x07, 0x0d, 0x84,
+    0x03, 0x00, 0x20, 0x4c, 0x08, 0x0c, 0x85, 0x06, 0x40, 0x20, 0x19, 0x00, 0x80, 0x0b, 0x83,
+    0x03, 0x00, 0x30, 0x36, 0x0e, 0x82, 0x82, 0x70, 0x18, 0x0f, 0x81, 0x18, 0x1c, 0x0f, 0x81,
+    0x08, 0x0e, 0x0f, 0x81, 0x18, 0x07, 0x0f, 0x81, 0x0c, 0x03, 0x0f, 0x82, 0x01, 0x81, 0x80,
+    0x0d, 0x83, 0x40, 0x00, 0xc1, 0x80, 0x0f, 0x81, 0x80, 0x80, 0x0d, 0x80, 0x80, 0x01, 0x80,
+    0xc0, 0x0f, 0x81, 0x20, 0x40, 0x0f, 0x80, 0x20, 0x0e, 0x83, 0x01, 0x00, 0x30, 0x20, 0x10,
+    0x80, 0x38, 0x0d, 0x83, 0x04, 0x00, 0x14, 0x30, 0x0d, 0x83, 0x01, 0x10, 0x07, 0xbe, 0x0f,
+    0x81, 0x03, 0xc0, 0x0f, 0x81, 0x03, 0xe0, 0x0f, 0x81, 0x01, 0xa0, 0x10, 0x80, 0x80, 0x3f,
+    0x3f, 0x3f, 0x1e, 0x3f, 0x3f, 0x3f, 0x3f, 0x17, 0x80, 0x10, 0x0e, 0x82, 0x04, 0x11, 0x7f,
+    0x0e, 0x82, 0x40, 0x3c, 0x2c, 0x0f, 0x81, 0x20, 0x22, 0x0e, 0x82, 0x01, 0xb0, 0x0b, 0x0e,
+    0x82, 0x01, 0x80, 0x0c, 0x0f, 0x81, 0xc1, 0x80, 0x0c, 0x83, 0x01, 0x00, 0x04, 0xc3, 0x0f,
+    0x81, 0x05, 0x46, 0x0e, 0x82, 0x80, 0x0f, 0x4e, 0x0f, 0x81, 0x0e, 0x1e, 0x0f, 0x81, 0x72,
+    0x3c, 0x0f, 0x81, 0x70, 0x38, 0x0f, 0x81, 0xf0, 0x70, 0x0d, 0x83, 0x06, 0xe0, 0x70, 0xe0,
+    0x0d, 0x83, 0x18, 0x30, 0xf1, 0xe0, 0x0d, 0x83, 0x1c, 0x18, 0xe3, 0xc0, 0x0d, 0x84, 0x15,
+    0xc8, 0xf3, 0xbf, 0x01, 0x0c, 0x84, 0x17, 0x8c, 0xb2, 0x3e, 0xc0, 0x0c, 0x84, 0x14, 0x01,
+    0x22, 0x2c, 0x30, 0x0c, 0x85, 0x04, 0x19, 0x21, 0xd5, 0xc0, 0x80, 0x0c, 0x84, 0x1d, 0x33,
+    0xe4, 0x00, 0x80, 0x0c, 0x82, 0x1b, 0x61, 0xe0, 0x0f, 0x81, 0xe0, 0xe0, 0x0f, 0x81, 0xf0,
+    0x70, 0x0f, 0x81, 0xe0, 0x78, 0x0f, 0x81, 0x72, 0x3c, 0x0f, 0x81, 0x0e, 0x1e, 0x0f, 0x81,
+    0x0f, 0x5e, 0x0f, 0x81, 0x05, 0x47, 0x0e, 0x82, 0x80, 0x05, 0xc3, 0x0f, 0x82, 0x01, 0xc0,
+    0x80, 0x0f, 0x81, 0xc0, 0x44, 0x0d, 0x83, 0x01, 0x00, 0xb0, 0x18, 0x0f, 0x81, 0x20, 0x06,
+    0x0f, 0x81, 0x2c, 0x1c, 0x0d, 0x83, 0x01, 0x10, 0x32, 0x4e, 0x3f, 0x3f, 0x3f, 0x3f, 0x26,
+    0x3f, 0x3f, 0x2a, 0x80, 0x08, 0x10, 0x80, 0x30, 0x10, 0x80, 0x20, 0x10, 0x80, 0x20, 0x0f,
+    0x81, 0x04, 0x60, 0x0f, 0x81, 0x34, 0xc0, 0x0e, 0x82, 0x01, 0xe3, 0xc0, 0x0e, 0x83, 0x07,
+    0xff, 0xd0, 0x10, 0x0d, 0x83, 0x0f, 0x87, 0xf6, 0xf0, 0x0d, 0x83, 0x1e, 0x07, 0xd9, 0xde,
+    0x0d, 0x83, 0x38, 0x02, 0x53, 0xf8, 0x0d, 0x83, 0x70, 0x02, 0x07, 0xec, 0x0d, 0x83, 0xe0,
+    0x63, 0x06, 0x10, 0x0d, 0x83, 0xc0, 0x33, 0x0c, 0x08, 0x0c, 0x84, 0x01, 0x80, 0x3a, 0x18,
+    0x0c, 0x0c, 0x84, 0x03, 0x00, 0x30, 0x30, 0x04, 0x0c, 0x84, 0x01, 0x00, 0x30, 0x20, 0x02,
+    0x10, 0x80, 0x02, 0x0e, 0x82, 0x40, 0x00, 0x03, 0x0e, 0x82, 0xe0, 0x00, 0x01, 0x0c, 0x84,
+    0x07, 0x70, 0x20, 0x00, 0x01, 0x0c, 0x84, 0x1f, 0x58, 0xc1, 0x00, 0x01, 0x0c, 0x85, 0x1f,
+    0x68, 0x82, 0x00, 0x01, 0x80, 0x0b, 0x85, 0x11, 0xf4, 0x82, 0x36, 0x00, 0x80, 0x0b, 0x85,
+    0x19, 0xfa, 0x83, 0x27, 0x01, 0x80, 0x0b, 0x85, 0x10, 0x6a, 0x83, 0x5e, 0x41, 0x80, 0x0c,
+    0x83, 0x07, 0x82, 0x3a, 0x81, 0x0d, 0x84, 0x01, 0x02, 0x2c, 0x01, 0x80, 0x0c, 0x83, 0x06,
+    0x41, 0x00, 0x01, 0x0d, 0x83, 0x06, 0xa0, 0x00, 0x01, 0x0d, 0x83, 0x02, 0xe0, 0x00, 0x03,
+    0x0e, 0x82, 0xc0, 0x40, 0x02, 0x0c, 0x80, 0x01, 0x02, 0x80, 0x02, 0x0c, 0x84, 0x01, 0x80,
+    0x30, 0x20, 0x04, 0x0c, 0x84, 0x01, 0xc0, 0x30, 0x20, 0x0c, 0x0d, 0x83, 0xc0, 0x3a, 0x18,
+    0x08, 0x0d, 0x83, 0x60, 0x32, 0x0c, 0x10, 0x0d, 0x83, 0x70, 0x62, 0x03, 0x20, 0x0d, 0x83,
+    0x3c, 0x03, 0x07, 0x84, 0x0d, 0x83, 0x1e, 0x03, 0x5b, 0xf8, 0x0d, 0x83, 0x0f, 0xc7, 0xf9,
+    0xfe, 0x0d, 0x83, 0x07, 0xf9, 0xf7, 0xec, 0x0e, 0x82, 0xe7, 0xf2, 0x30, 0x0e, 0x81, 0x17,
+    0xc0, 0x0f, 0x81, 0x04, 0xc0, 0x10, 0x80, 0x60, 0x10, 0x80, 0x20, 0x10, 0x80, 0x30, 0x10,
+    0x80, 0x10, 0x3f, 0x3f, 0x3b, 0x3f, 0x3f, 0x2a, 0x80, 0x08, 0x10, 0x80, 0x30, 0x10, 0x80,
+    0x20, 0x10, 0x80, 0x20, 0x0f, 0x81, 0x04, 0x60, 0x0f, 0x81, 0x04, 0xc0, 0x0f, 0x81, 0x07,
+    0xc0, 0x0f, 0x81, 0x07, 0xc0, 0x0f, 0x81, 0x07, 0xc1, 0x0f, 0x81, 0x07, 0xe6, 0x0f, 0x81,
+    0x03, 0xec, 0x0f, 0x81, 0x03, 0xf8, 0x0f, 0x81, 0x63, 0xf8, 0x0f, 0x81, 0x37, 0xf0, 0x0f,
+    0x81, 0x3f, 0xe0, 0x0f, 0x81, 0x3f, 0xc0, 0x0f, 0x81, 0x3f, 0xc0, 0x0f, 0x81, 0x7f, 0xc0,
+    0x0f, 0x81, 0x3f, 0xc0, 0x0f, 0x81, 0x1f, 0x80, 0x0e, 0x81, 0x70, 0x5f, 0x0f, 0x81, 0x98,
+    0x3f, 0x0f, 0x81, 0x88, 0x7e, 0x10, 0x81, 0x7d, 0x8e, 0x0d, 0x84, 0x08, 0x08, 0x7d, 0xe5,
+    0x60, 0x0d, 0x83, 0x14, 0x7e, 0xc1, 0xf8, 0x0d, 0x83, 0x19, 0x7c, 0x09, 0xfc, 0x0d, 0x83,
+    0x1f, 0xfe, 0x0c, 0xfc, 0x0d, 0x83, 0x1e, 0xbf, 0x00, 0x38, 0x0d, 0x83, 0x06, 0x5f, 0x00,
+    0x1e, 0x0d, 0x83, 0x02, 0x1f, 0x80, 0x7f, 0x0e, 0x83, 0x3f, 0xc0, 0x7f, 0x80, 0x0d, 0x83,
+    0x7f, 0xc0, 0x7f, 0xc0, 0x0d, 0x83, 0x3f, 0xc0, 0x0f, 0xe0, 0x0d, 0x83, 0x3f, 0xc0, 0x07,
+    0xe0, 0x0d, 0x83, 0x3f, 0xe0, 0x0f, 0xf0, 0x0d, 0x83, 0x37, 0xf0, 0x0f, 0xf0, 0x0d, 0x83,
+    0x63, 0xfc, 0x0f, 0xf0, 0x0d, 0x83, 0x03, 0xf8, 0x0f, 0xf8, 0x0d, 0x83, 0x03, 0xe4, 0x0f,
+    0xf8, 0x0d, 0x83, 0x07, 0xc6, 0x0f, 0xf8, 0x0d, 0x83, 0x07, 0xc0, 0x07, 0xf0, 0x0d, 0x83,
+    0x07, 0xc0, 0x07, 0xe0, 0x0d, 0x83, 0x07, 0xc0, 0x07, 0xe0, 0x0d, 0x83, 0x04, 0xc0, 0x03,
+    0xc0, 0x0e, 0x82, 0x60, 0x01, 0xc0, 0x0e, 0x80, 0x20, 0x10, 0x80, 0x30, 0x10, 0x80, 0x10,
+    0x3f, 0x3f, 0x3b,
+};
+
+const struct delta_anim pokemon_anim = {
+    .w = 140,
+    .h = 68,
+    .frame_count = 20,
+    .loop = 382,
+    .data = pokemon_anim_stream,
+};
@@ -1,3 +1,6 @@
+/* LV_IMG_CF_USER_ENCODED_0 images are run-length encoded by scripts/encode_image.py,
+ * see widgets/rle_img.h */
+
 /*
  *
  * Copyright (c) 2023 Collin Hodge
@@ -27,116 +30,94 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_VIM
         0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
 #endif
 
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xfe, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa4, 0xff, 0xff, 0x80,
-        0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xf9, 0x52, 0x7f, 0xff, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xa9, 0x3f, 0xfe, 0x60,
-        0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xe5, 0x54, 0x9f, 0xfe, 0xd0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0a, 0xaa, 0x40, 0x00, 0xe0,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e,
-        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f,
-        0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-        0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xf4, 0x00, 0x2a, 0xaa, 0xaa, 0x80,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95,
-        0xfa, 0x00, 0x07, 0xff, 0xff, 0xc0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xfd, 0x00, 0x03, 0xff, 0xff, 0xc0,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x75,
-        0x7e, 0x80, 0x01, 0xff, 0xff, 0xe0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xfc, 0xce, 0xbf, 0x40, 0x00, 0xd5, 0x54, 0xd0,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xc3,
-        0xdf, 0xa0, 0x00, 0x6a, 0xaa, 0xe0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xf2, 0xc0, 0x7d, 0xd0, 0x00, 0x35, 0x55, 0x7f,
-        0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xc0,
-        0x0c, 0xe8, 0x00, 0x1a, 0xaa, 0xbf, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xea, 0xc0, 0x00, 0xf4, 0x00, 0x0d, 0x55, 0x54,
-        0x4f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xed, 0xdc,
-        0x00, 0xfa, 0x00, 0x06, 0xaa, 0xaa, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xee, 0xef, 0x80, 0xed, 0x00, 0x03, 0x55, 0x55,
-        0x2f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xef, 0x55,
-        0xf0, 0xe2, 0x80, 0x01, 0xaa, 0xaa, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xe7, 0xea, 0xbc, 0xe1, 0x40, 0x00, 0xd5, 0x54,
-        0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xdd,
-        0x57, 0x61, 0xa0, 0x00, 0x6a, 0xa9, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xf9, 0xc3, 0xaa, 0xf9, 0xd0, 0x00, 0x35, 0x52,
-        0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xc0,
-        0x77, 0xaf, 0xe8, 0x00, 0x1a, 0xa4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x1d, 0x55, 0xf4, 0x00, 0x0d, 0x7f,
-        0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60,
-        0x01, 0xaa, 0xfa, 0x00, 0x06, 0xe0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x01, 0x55, 0x7d, 0x00, 0x03, 0xd0,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-        0xc1, 0xaa, 0xbe, 0x80, 0x01, 0xe0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0xe1, 0x55, 0x5f, 0x40, 0x00, 0xc0,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x73,
-        0x71, 0xaa, 0xaf, 0xa0, 0x00, 0x40, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xfe, 0xcf, 0xb3, 0x55, 0x57, 0xd0, 0x00, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc1,
-        0xf2, 0xaa, 0xab, 0xe8, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x33, 0x55, 0x55, 0xf4, 0x00, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0,
-        0x01, 0xaa, 0xaa, 0xfa, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xfe, 0xd8, 0x01, 0x55, 0x55, 0x7d, 0x00, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f,
-        0x01, 0xaa, 0xaa, 0xbe, 0x80, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xe1, 0x55, 0x55, 0x5f, 0x40, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-        0x31, 0xaa, 0xaa, 0xaf, 0xa0, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x33, 0xd5, 0x55, 0x57, 0xd0, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xce,
-        0x32, 0xea, 0xaa, 0xa7, 0xe8, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xfe, 0xc1, 0xf2, 0x75, 0x55, 0x49, 0xf4, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0,
-        0x31, 0x3a, 0xaa, 0x90, 0xfa, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x01, 0x1d, 0x55, 0x26, 0x7d, 0x00,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xd8,
-        0x01, 0x4e, 0xaa, 0x4f, 0x3e, 0x80, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xfe, 0x6f, 0x01, 0x67, 0x54, 0x9f, 0x9f, 0x40,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
-        0xe1, 0x73, 0xa9, 0x3f, 0xcf, 0xa0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3e, 0x79, 0xd2, 0x7f, 0xe7, 0xd0,
-        0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0x80, 0xfc, 0xe4, 0xff, 0xf3, 0xe8, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x69, 0xff, 0xf9, 0xf4,
-        0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x33, 0xff, 0xfc, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xfe, 0x00,
-        0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+        0x8f, 0xff, 0x00, 0xf0, 0x86, 0xff, 0x00, 0x87, 0x86, 0xff, 0x00, 0xf0,
+        0x86, 0xff, 0x00, 0x33, 0x86, 0xff, 0x00, 0xf0, 0x85, 0xff, 0x01, 0xfe,
+        0x49, 0x86, 0xff, 0x00, 0xf0, 0x85, 0xff, 0x05, 0xfc, 0xa4, 0xff, 0xff,
+        0x80, 0x7f, 0x82, 0xff, 0x00, 0xf0, 0x85, 0xff, 0x05, 0xf9, 0x52, 0x7f,
+        0xff, 0x3f, 0x3f, 0x82, 0xff, 0x00, 0xf0, 0x85, 0xff, 0x05, 0xf2, 0xa9,
+        0x3f, 0xfe, 0x60, 0x9f, 0x82, 0xff, 0x00, 0xf0, 0x85, 0xff, 0x05, 0xe5,
+        0x54, 0x9f, 0xfe, 0xd0, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x83, 0xff, 0x07,
+        0x80, 0x00, 0x0a, 0xaa, 0x40, 0x00, 0xe0, 0x5f, 0x82, 0xff, 0x00, 0xf0,
+        0x83, 0xff, 0x00, 0x3f, 0x83, 0xff, 0x01, 0xc0, 0x5f, 0x82, 0xff, 0x00,
+        0xf0, 0x83, 0xff, 0x00, 0x70, 0x84, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00,
+        0xf0, 0x83, 0xff, 0x00, 0x60, 0x84, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00,
+        0xf0, 0x83, 0xff, 0x00, 0x70, 0x84, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00,
+        0xf0, 0x83, 0xff, 0x00, 0x60, 0x84, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00,
+        0xf0, 0x83, 0xff, 0x00, 0x70, 0x84, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00,
+        0xf0, 0x83, 0xff, 0x00, 0x68, 0x84, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00,
+        0xf0, 0x83, 0xff, 0x00, 0x74, 0x84, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00,
+        0xf0, 0x83, 0xff, 0x00, 0x7a, 0x84, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00,
+        0xf0, 0x83, 0xff, 0x00, 0x7d, 0x84, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00,
+        0xf0, 0x83, 0xff, 0x01, 0x3e, 0x80, 0x83, 0x00, 0x00, 0x5f, 0x82, 0xff,
+        0x00, 0xf0, 0x83, 0xff, 0x01, 0xbf, 0x40, 0x83, 0x00, 0x00, 0x5f, 0x82,
+        0xff, 0x00, 0xf0, 0x83, 0xff, 0x01, 0x9f, 0xa0, 0x83, 0x00, 0x00, 0x5f,
+        0x82, 0xff, 0x00, 0xf0, 0x83, 0xff, 0x01, 0xcf, 0xd0, 0x83, 0x00, 0x00,
+        0x5f, 0x82, 0xff, 0x00, 0xf0, 0x83, 0xff, 0x01, 0xe7, 0xe8, 0x83, 0x00,
+        0x00, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x83, 0xff, 0x07, 0xcb, 0xf4, 0x00,
+        0x2a, 0xaa, 0xaa, 0x80, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x83, 0xff, 0x07,
+        0x95, 0xfa, 0x00, 0x07, 0xff, 0xff, 0xc0, 0x5f, 0x82, 0xff, 0x00, 0xf0,
+        0x83, 0xff, 0x07, 0x2a, 0xfd, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x5f, 0x82,
+        0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xfe, 0x75, 0x7e, 0x80, 0x01, 0xff,
+        0xff, 0xe0, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xfc, 0xce,
+        0xbf, 0x40, 0x00, 0xd5, 0x54, 0xd0, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x82,
+        0xff, 0x08, 0xf9, 0xc3, 0xdf, 0xa0, 0x00, 0x6a, 0xaa, 0xe0, 0xdf, 0x82,
+        0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xf2, 0xc0, 0x7d, 0xd0, 0x00, 0x35,
+        0x55, 0x7f, 0x9f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xe5, 0xc0,
+        0x0c, 0xe8, 0x00, 0x1a, 0xaa, 0xbf, 0x9f, 0x82, 0xff, 0x00, 0xf0, 0x82,
+        0xff, 0x08, 0xea, 0xc0, 0x00, 0xf4, 0x00, 0x0d, 0x55, 0x54, 0x4f, 0x82,
+        0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xed, 0xdc, 0x00, 0xfa, 0x00, 0x06,
+        0xaa, 0xaa, 0x2f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xee, 0xef,
+        0x80, 0xed, 0x00, 0x03, 0x55, 0x55, 0x2f, 0x82, 0xff, 0x00, 0xf0, 0x82,
+        0xff, 0x08, 0xef, 0x55, 0xf0, 0xe2, 0x80, 0x01, 0xaa, 0xaa, 0x4f, 0x82,
+        0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xe7, 0xea, 0xbc, 0xe1, 0x40, 0x00,
+        0xd5, 0x54, 0x9f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xf3, 0xdd,
+        0x57, 0x61, 0xa0, 0x00, 0x6a, 0xa9, 0x3f, 0x82, 0xff, 0x00, 0xf0, 0x82,
+        0xff, 0x08, 0xf9, 0xc3, 0xaa, 0xf9, 0xd0, 0x00, 0x35, 0x52, 0x7f, 0x82,
+        0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xfc, 0xc0, 0x77, 0xaf, 0xe8, 0x00,
+        0x1a, 0xa4, 0x7f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xfe, 0xc0,
+        0x1d, 0x55, 0xf4, 0x00, 0x0d, 0x7f, 0x3f, 0x82, 0xff, 0x00, 0xf0, 0x82,
+        0xff, 0x08, 0xfe, 0x60, 0x01, 0xaa, 0xfa, 0x00, 0x06, 0xe0, 0x9f, 0x82,
+        0xff, 0x00, 0xf0, 0x83, 0xff, 0x07, 0x3e, 0x01, 0x55, 0x7d, 0x00, 0x03,
+        0xd0, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x83, 0xff, 0x07, 0x8f, 0xc1, 0xaa,
+        0xbe, 0x80, 0x01, 0xe0, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x83, 0xff, 0x07,
+        0x06, 0xe1, 0x55, 0x5f, 0x40, 0x00, 0xc0, 0x5f, 0x82, 0xff, 0x00, 0xf0,
+        0x82, 0xff, 0x08, 0xfe, 0x73, 0x71, 0xaa, 0xaf, 0xa0, 0x00, 0x40, 0x5f,
+        0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xfe, 0xcf, 0xb3, 0x55, 0x57,
+        0xd0, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xfe,
+        0xc1, 0xf2, 0xaa, 0xab, 0xe8, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00, 0xf0,
+        0x82, 0xff, 0x08, 0xfe, 0xc0, 0x33, 0x55, 0x55, 0xf4, 0x00, 0x00, 0x5f,
+        0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xfe, 0xc0, 0x01, 0xaa, 0xaa,
+        0xfa, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xfe,
+        0xd8, 0x01, 0x55, 0x55, 0x7d, 0x00, 0x00, 0x5f, 0x82, 0xff, 0x00, 0xf0,
+        0x82, 0xff, 0x08, 0xfe, 0x7f, 0x01, 0xaa, 0xaa, 0xbe, 0x80, 0x00, 0x5f,
+        0x82, 0xff, 0x00, 0xf0, 0x83, 0xff, 0x07, 0x01, 0xe1, 0x55, 0x55, 0x5f,
+        0x40, 0x00, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x83, 0xff, 0x07, 0x00, 0x31,
+        0xaa, 0xaa, 0xaf, 0xa0, 0x00, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff,
+        0x08, 0xfe, 0x70, 0x33, 0xd5, 0x55, 0x57, 0xd0, 0x00, 0x5f, 0x82, 0xff,
+        0x00, 0xf0, 0x82, 0xff, 0x08, 0xfe, 0xce, 0x32, 0xea, 0xaa, 0xa7, 0xe8,
+        0x00, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xfe, 0xc1, 0xf2,
+        0x75, 0x55, 0x49, 0xf4, 0x00, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff,
+        0x08, 0xfe, 0xc0, 0x31, 0x3a, 0xaa, 0x90, 0xfa, 0x00, 0x5f, 0x82, 0xff,
+        0x00, 0xf0, 0x82, 0xff, 0x08, 0xfe, 0xc0, 0x01, 0x1d, 0x55, 0x26, 0x7d,
+        0x00, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff, 0x08, 0xfe, 0xd8, 0x01,
+        0x4e, 0xaa, 0x4f, 0x3e, 0x80, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x82, 0xff,
+        0x08, 0xfe, 0x6f, 0x01, 0x67, 0x54, 0x9f, 0x9f, 0x40, 0x5f, 0x82, 0xff,
+        0x00, 0xf0, 0x83, 0xff, 0x07, 0x01, 0xe1, 0x73, 0xa9, 0x3f, 0xcf, 0xa0,
+        0x5f, 0x82, 0xff, 0x00, 0xf0, 0x83, 0xff, 0x07, 0xfc, 0x3e, 0x79, 0xd2,
+        0x7f, 0xe7, 0xd0, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x84, 0xff, 0x06, 0x80,
+        0xfc, 0xe4, 0xff, 0xf3, 0xe8, 0x5f, 0x82, 0xff, 0x00, 0xf0, 0x85, 0xff,
+        0x05, 0xfe, 0x69, 0xff, 0xf9, 0xf4, 0x9f, 0x82, 0xff, 0x00, 0xf0, 0x86,
+        0xff, 0x04, 0x33, 0xff, 0xfc, 0xff, 0x3f, 0x82, 0xff, 0x00, 0xf0, 0x86,
+        0xff, 0x04, 0x87, 0xff, 0xfe, 0x00, 0x7f, 0x82, 0xff, 0x00, 0xf0, 0x8f,
+        0xff, 0x00, 0xf0,
 };
 
 const lv_img_dsc_t vim = {
-    .header.cf = LV_IMG_CF_INDEXED_1BIT,
+    .header.cf = LV_IMG_CF_USER_ENCODED_0,
     .header.always_zero = 0,
     .header.reserved = 0,
     .header.w = 140,
     .header.h = 68,
-    .data_size = 1232,
+    .data_size = sizeof(vim_map),
     .data = vim_map,
 };
@@ -1,3 +1,6 @@
+/* LV_IMG_CF_USER_ENCODED_0 images are run-length encoded by scripts/encode_image.py,
+ * see widgets/rle_img.h */
+
 #ifdef __has_include
     #if __has_include("lvgl.h")
         #ifndef LV_LVGL_H_INCLUDE_SIMPLE
@@ -25,82 +28,74 @@ const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_VIP_MARCO
   0xf5, 0xf5, 0xf5, 0xff, 	/*Color of index 0*/
   0x00, 0x00, 0x00, 0xff, 	/*Color of index 1*/
 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf7, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf0, 0x1f, 0x3f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe1, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf1, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf0, 0x7f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe0, 0x07, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xf1, 0xf8, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf3, 0x83, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe2, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x02, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x03, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe0, 0x11, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf0, 0x1d, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0x9d, 0xff, 0xff, 0xfe, 0xaf, 0xe0, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf8, 0x01, 0xff, 0xff, 0xfe, 0xa7, 0xcb, 0x7e, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf3, 0xfb, 0xff, 0xff, 0xfe, 0xa3, 0x8b, 0xfe, 0xfe, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xf9, 0xff, 0xff, 0xfe, 0xa9, 0xab, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0x39, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0x19, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0x7f, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0x19, 0xff, 0xff, 0xfe, 0xaa, 0x2b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0x19, 0xff, 0xff, 0xfe, 0xa8, 0x8b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf0, 0x03, 0xff, 0xff, 0xf2, 0xa1, 0xcb, 0x7c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf9, 0xe3, 0xff, 0xff, 0xfc, 0x0f, 0xe0, 0x7c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x79, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x79, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf7, 0x33, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe6, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xe7, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf3, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xf8, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xfc, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 
+  0x8f, 0xff, 0x00, 0xf0, 0x8f, 0xff, 0x00, 0xf0, 0x8f, 0xff, 0x00, 0xf0,
+  0x8f, 0xff, 0x00, 0xf0, 0x8f, 0xff, 0x00, 0xf0, 0x8f, 0xff, 0x04, 0xf0,
+  0xff, 0xf0, 0x00, 0x7f, 0x8b, 0xff, 0x04, 0xf0, 0xff, 0xe0, 0x00, 0x3f,
+  0x82, 0xff, 0x01, 0xef, 0xdf, 0x85, 0xff, 0x04, 0xf0, 0xff, 0xe7, 0xff,
+  0x3f, 0x82, 0xff, 0x02, 0xef, 0xef, 0xf7, 0x84, 0xff, 0x04, 0xf0, 0xff,
+  0xe7, 0xff, 0x3f, 0x83, 0xff, 0x01, 0xf7, 0xf7, 0x84, 0xff, 0x04, 0xf0,
+  0xff, 0xf7, 0xff, 0x3f, 0x84, 0xff, 0x00, 0xf7, 0x84, 0xff, 0x04, 0xf0,
+  0xff, 0xf0, 0x1f, 0x3f, 0x81, 0xff, 0x00, 0xf7, 0x87, 0xff, 0x04, 0xf0,
+  0xff, 0xe1, 0xf0, 0x3f, 0x81, 0xff, 0x00, 0xf7, 0x87, 0xff, 0x03, 0xf0,
+  0xff, 0xe7, 0x03, 0x86, 0xff, 0x00, 0xef, 0x83, 0xff, 0x03, 0xf0, 0xff,
+  0xe7, 0x03, 0x86, 0xff, 0x00, 0xdf, 0x83, 0xff, 0x04, 0xf0, 0xff, 0xf1,
+  0xf0, 0x7f, 0x83, 0xff, 0x00, 0x00, 0x85, 0xff, 0x04, 0xf0, 0xff, 0xf0,
+  0x7f, 0x3f, 0x82, 0xff, 0x01, 0xfc, 0x01, 0x85, 0xff, 0x04, 0xf0, 0xff,
+  0xe0, 0x07, 0x3f, 0x82, 0xff, 0x00, 0xe0, 0x86, 0xff, 0x04, 0xf0, 0xff,
+  0xe7, 0xff, 0x3f, 0x82, 0xff, 0x00, 0x87, 0x86, 0xff, 0x04, 0xf0, 0xff,
+  0xe7, 0xff, 0x3f, 0x81, 0xff, 0x01, 0xfc, 0x3f, 0x86, 0xff, 0x08, 0xf0,
+  0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xf1, 0xf8, 0x81, 0xff, 0x00, 0xef,
+  0x83, 0xff, 0x04, 0xf0, 0xff, 0xf0, 0x00, 0x7f, 0x81, 0xff, 0x04, 0xfc,
+  0x03, 0xff, 0xff, 0xdf, 0x83, 0xff, 0x03, 0xf0, 0xff, 0xf3, 0x83, 0x82,
+  0xff, 0x02, 0xfe, 0x00, 0x1f, 0x85, 0xff, 0x03, 0xf0, 0xff, 0xe7, 0xdb,
+  0x83, 0xff, 0x02, 0xfe, 0x03, 0xef, 0x84, 0xff, 0x03, 0xf0, 0xff, 0xe6,
+  0x49, 0x85, 0xff, 0x00, 0xd7, 0x84, 0xff, 0x03, 0xf0, 0xff, 0xe6, 0x49,
+  0x85, 0xff, 0x00, 0xbb, 0x84, 0xff, 0x03, 0xf0, 0xff, 0xe2, 0x49, 0x85,
+  0xff, 0x01, 0x77, 0xc7, 0x83, 0xff, 0x03, 0xf0, 0xff, 0xe7, 0xfb, 0x82,
+  0xff, 0x03, 0xfc, 0x00, 0x02, 0xef, 0x84, 0xff, 0x03, 0xf0, 0xff, 0xe7,
+  0xf3, 0x82, 0xff, 0x03, 0xfc, 0x00, 0x03, 0x77, 0x84, 0xff, 0x03, 0xf0,
+  0xff, 0xe0, 0x03, 0x85, 0xff, 0x00, 0xbb, 0x84, 0xff, 0x03, 0xf0, 0xff,
+  0xe0, 0x01, 0x85, 0xff, 0x00, 0xd7, 0x84, 0xff, 0x03, 0xf0, 0xff, 0xe7,
+  0xfd, 0x85, 0xff, 0x00, 0xef, 0x84, 0xff, 0x03, 0xf0, 0xff, 0xe7, 0xfd,
+  0x8c, 0xff, 0x0a, 0xf0, 0xff, 0xe0, 0x11, 0xff, 0xff, 0xf0, 0x3f, 0xff,
+  0x00, 0x03, 0x85, 0xff, 0x0a, 0xf0, 0xff, 0xf0, 0x1d, 0xff, 0xff, 0xf2,
+  0x9f, 0xff, 0x00, 0x01, 0x85, 0xff, 0x0a, 0xf0, 0xff, 0xff, 0x9d, 0xff,
+  0xff, 0xfe, 0xaf, 0xe0, 0x7f, 0xfe, 0x85, 0xff, 0x0a, 0xf0, 0xff, 0xf8,
+  0x01, 0xff, 0xff, 0xfe, 0xa7, 0xcb, 0x7e, 0xfe, 0x85, 0xff, 0x0c, 0xf0,
+  0xff, 0xf3, 0xfb, 0xff, 0xff, 0xfe, 0xa3, 0x8b, 0xfe, 0xfe, 0xff, 0xe3,
+  0x83, 0xff, 0x0a, 0xf0, 0xff, 0xe7, 0xf9, 0xff, 0xff, 0xfe, 0xa9, 0xab,
+  0xfe, 0xfe, 0x85, 0xff, 0x03, 0xf0, 0xff, 0xe7, 0x39, 0x81, 0xff, 0x03,
+  0xf8, 0x3f, 0xff, 0x7e, 0x85, 0xff, 0x03, 0xf0, 0xff, 0xe6, 0x19, 0x81,
+  0xff, 0x03, 0xfe, 0x7f, 0x7f, 0x81, 0x85, 0xff, 0x09, 0xf0, 0xff, 0xe6,
+  0x19, 0xff, 0xff, 0xfe, 0xaa, 0x2b, 0x7f, 0x86, 0xff, 0x09, 0xf0, 0xff,
+  0xe6, 0x19, 0xff, 0xff, 0xfe, 0xa8, 0x8b, 0x7f, 0x86, 0xff, 0x0a, 0xf0,
+  0xff, 0xf0, 0x03, 0xff, 0xff, 0xf2, 0xa1, 0xcb, 0x7c, 0x3f, 0x85, 0xff,
+  0x0a, 0xf0, 0xff, 0xf9, 0xe3, 0xff, 0xff, 0xfc, 0x0f, 0xe0, 0x7c, 0x1f,
+  0x85, 0xff, 0x03, 0xf0, 0xff, 0xf3, 0xf3, 0x82, 0xff, 0x02, 0xfe, 0x79,
+  0xdf, 0x85, 0xff, 0x03, 0xf0, 0xff, 0xe7, 0xf9, 0x82, 0xff, 0x02, 0xfe,
+  0x79, 0xdf, 0x85, 0xff, 0x03, 0xf0, 0xff, 0xe6, 0x19, 0x83, 0xff, 0x01,
+  0x33, 0x9f, 0x85, 0xff, 0x03, 0xf0, 0xff, 0xe6, 0x19, 0x83, 0xff, 0x00,
+  0x87, 0x86, 0xff, 0x03, 0xf0, 0xff, 0xe6, 0x19, 0x85, 0xff, 0x01, 0xfe,
+  0x7f, 0x83, 0xff, 0x03, 0xf0, 0xff, 0xe7, 0xfb, 0x86, 0xff, 0x00, 0x7f,
+  0x83, 0xff, 0x03, 0xf0, 0xff, 0xf3, 0xf3, 0x8c, 0xff, 0x03, 0xf0, 0xff,
+  0xf0, 0x07, 0x82, 0xff, 0x00, 0xef, 0x87, 0xff, 0x03, 0xf0, 0xff, 0xf7,
+  0x33, 0x82, 0xff, 0x00, 0xdf, 0x87, 0xff, 0x03, 0xf0, 0xff, 0xe6, 0x79,
+  0x8c, 0xff, 0x03, 0xf0, 0xff, 0xe6, 0xf9, 0x8c, 0xff, 0x03, 0xf0, 0xff,
+  0xe6, 0xd9, 0x84, 0xff, 0x00, 0xfd, 0x85, 0xff, 0x03, 0xf0, 0xff, 0xe7,
+  0xd9, 0x83, 0xff, 0x01, 0xf7, 0xfd, 0x85, 0xff, 0x03, 0xf0, 0xff, 0xe7,
+  0xd9, 0x83, 0xff, 0x00, 0xe7, 0x86, 0xff, 0x03, 0xf0, 0xff, 0xf3, 0x9b,
+  0x8c, 0xff, 0x03, 0xf0, 0xff, 0xf8, 0x23, 0x8c, 0xff, 0x03, 0xf0, 0xff,
+  0xfc, 0x77, 0x8c, 0xff, 0x00, 0xf0, 0x8f, 0xff, 0x00, 0xf0, 0x8f, 0xff,
+  0x00, 0xf0, 0x8f, 0xff, 0x00, 0xf0, 0x8f, 0xff, 0x00, 0xf0, 0x8f, 0xff,
+  0x00, 0xf0, 0x8f, 0xff, 0x00, 0xf0,
 };
 
 const lv_img_dsc_t vip_marcos = {
-  .header.cf = LV_IMG_CF_INDEXED_1BIT,
+  .header.cf = LV_IMG_CF_USER_ENCODED_0,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 140,
   .header.h = 68,
-  .data_size = 1232,
+  .data_size = sizeof(vip_marcos_map),
   .data = vip_marcos_map,
 };
@@ -1,10 +1,11 @@
+#include "../widgets/rle_img.h"
 #include "widgets/screen.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
-#include "assets/pixel_operator_mono.c"
-#include "assets/custom_fonts.h"
+#include "../assets/pixel_operator_mono.c"
+#include "../assets/custom_fonts.h"
 
 #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STATUS)
 static struct zmk_widget_screen screen_widget;
@@ -14,6 +15,9 @@ lv_obj_t *zmk_display_status_screen() {
     lv_obj_t *screen;
     screen = lv_obj_create(NULL);
 
+    // Before any image object looks up an encoded asset
+    rle_img_decoder_init();
+
 #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STATUS)
     zmk_widget_screen_init(&screen_widget, screen);
     lv_obj_align(zmk_widget_screen_obj(&screen_widget), LV_ALIGN_TOP_LEFT, 0, 0);
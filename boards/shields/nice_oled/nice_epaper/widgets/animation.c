@@ -1,47 +1,27 @@
 #include <stdlib.h>
 #include <zephyr/kernel.h>
 #include "animation.h"
+#include "../../widgets/delta_anim.h"
 
-LV_IMG_DECLARE(crystal_01);
-LV_IMG_DECLARE(crystal_02);
-LV_IMG_DECLARE(crystal_03);
-LV_IMG_DECLARE(crystal_04);
-LV_IMG_DECLARE(crystal_05);
-LV_IMG_DECLARE(crystal_06);
-LV_IMG_DECLARE(crystal_07);
-LV_IMG_DECLARE(crystal_08);
-LV_IMG_DECLARE(crystal_09);
-LV_IMG_DECLARE(crystal_10);
-LV_IMG_DECLARE(crystal_11);
-LV_IMG_DECLARE(crystal_12);
-LV_IMG_DECLARE(crystal_13);
-LV_IMG_DECLARE(crystal_14);
-LV_IMG_DECLARE(crystal_15);
-LV_IMG_DECLARE(crystal_16);
+extern const struct delta_anim crystal_anim;
 
-const lv_img_dsc_t *anim_imgs[] = {
-    &crystal_01, &crystal_02, &crystal_03, &crystal_04, &crystal_05, &crystal_06,
-    &crystal_07, &crystal_08, &crystal_09, &crystal_10, &crystal_11, &crystal_12,
-    &crystal_13, &crystal_14, &crystal_15, &crystal_16,
-};
+// Frames are decoded one at a time into this buffer
+static struct delta_anim_player player;
+static uint8_t frame_buf[DELTA_ANIM_BUF_SIZE(69, 68)];
 
 void draw_animation(lv_obj_t *canvas, struct zmk_widget_screen *widget) {
+    delta_anim_init(&player, &crystal_anim, frame_buf, LVGL_BACKGROUND, LVGL_FOREGROUND);
+
 #if IS_ENABLED(CONFIG_NICE_OLED_GEM_ANIMATION)
-    lv_obj_t *art = lv_animimg_create(widget->obj);
+    lv_obj_t *art = delta_anim_create(widget->obj, &player, CONFIG_NICE_OLED_GEM_ANIMATION_MS);
     lv_obj_center(art);
-
-    lv_animimg_set_src(art, (const void **)anim_imgs, 16);
-    lv_animimg_set_duration(art, CONFIG_NICE_OLED_GEM_ANIMATION_MS);
-    lv_animimg_set_repeat_count(art, LV_ANIM_REPEAT_INFINITE);
-    lv_animimg_start(art);
 #else
     lv_obj_t *art = lv_img_create(widget->obj);
 
-    int length = sizeof(anim_imgs) / sizeof(anim_imgs[0]);
     srand(k_uptime_get_32());
-    int random_index = rand() % length;
+    delta_anim_seek(&player, rand() % crystal_anim.frame_count);
 
-    lv_img_set_src(art, anim_imgs[random_index]);
+    lv_img_set_src(art, &player.img);
 #endif
 
     lv_obj_align(art, LV_ALIGN_TOP_LEFT, 36, 0);
@@ -1,6 +1,6 @@
 #include <zephyr/kernel.h>
 #include "battery.h"
-#include "../assets/custom_fonts.h"
+#include "../../assets/custom_fonts.h"
 
 LV_IMG_DECLARE(bolt);
 
@@ -59,7 +59,7 @@ static void draw_level(lv_obj_t *canvas, const struct status_state *state) {
     char text[10] = {};
 
     sprintf(text, "%i%%", state->battery);
-    lv_canvas_draw_text(canvas, 26, 19, 42, &label_right_dsc, text);
+    canvas_draw_text(canvas, 26, 19, 42, &label_right_dsc, text);
 }
 
 static void draw_charging_level(lv_obj_t *canvas, const struct status_state *state) {
@@ -71,14 +71,14 @@ static void draw_charging_level(lv_obj_t *canvas, const struct status_state *sta
     char text[10] = {};
 
     sprintf(text, "%i%%", state->battery);
-    lv_canvas_draw_text(canvas, 26, 19, 35, &label_right_dsc, text);
-    lv_canvas_draw_img(canvas, 62, 21, &bolt, &img_dsc);
+    canvas_draw_text(canvas, 26, 19, 35, &label_right_dsc, text);
+    canvas_draw_img(canvas, 62, 21, &bolt, &img_dsc);
 }
 
 void draw_battery_status(lv_obj_t *canvas, const struct status_state *state) {
     lv_draw_label_dsc_t label_left_dsc;
     init_label_dsc(&label_left_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_LEFT);
-    lv_canvas_draw_text(canvas, 0, 19, 25, &label_left_dsc, "BAT");
+    canvas_draw_text(canvas, 0, 19, 25, &label_left_dsc, "BAT");
 
     if (state->charging) {
         // draw_battery_status_charging_level_big(canvas, state);
@@ -11,10 +11,11 @@
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #include "hid_indicators.h"
+#include "../../widgets/luna_sprite.h"
 #include <zmk/display.h>
 #include <zmk/event_manager.h>
 #include <zmk/events/hid_indicators_changed.h>
-// #include "../assets/custom_fonts.h"
+// #include "../../assets/custom_fonts.h"
 
 #define LED_NLCK 0x01
 #define LED_CLCK 0x02
@@ -34,15 +35,16 @@ LV_IMG_DECLARE(dog_bark2_90);
 // &dog_walk2, &dog_run1, &dog_run2, &dog_bark1, &dog_bark2, &dog_sneak1,
 // &dog_sneak2};
 const lv_img_dsc_t *luna_imgs_bark_90[] = {&dog_bark1_90, &dog_bark2_90};
-static lv_obj_t *hid_anim =
-    NULL; // Variable estática para almacenar el objeto animado
+
+#define ANIMATION_MS CONFIG_NICE_OLED_WIDGET_HID_INDICATORS_LUNA_ANIMATION_MS
+
+static const struct luna_sprite_clip luna_clip_bark =
+    LUNA_SPRITE_CLIP(luna_imgs_bark_90, ANIMATION_MS);
 
 struct hid_indicators_state {
   uint8_t hid_indicators;
 };
 
-static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
-
 /* WORK FINE
 static void set_hid_indicators(lv_obj_t *label, struct hid_indicators_state
 state) {
@@ -72,77 +74,18 @@ state) {
 }
 */
 
-static void set_hid_indicators(lv_obj_t *label,
-                               struct hid_indicators_state state) {
-  // char text[14] = "";
-
-  // Construir el texto según los indicadores activos.
-  // Se agregan las letras correspondientes si cada indicador está activo.
-
+static void set_hid_indicators(struct hid_indicators_state state) {
 #if IS_ENABLED(CONFIG_NICE_OLED_WIDGET_HID_INDICATORS_LUNA_ONLY_CAPSLOCK)
-  if (state.hid_indicators & LED_CLCK) {
+  bool bark = state.hid_indicators & LED_CLCK;
 #else
-  if (state.hid_indicators & (LED_CLCK | LED_NLCK | LED_SLCK)) {
+  bool bark = state.hid_indicators & (LED_CLCK | LED_NLCK | LED_SLCK);
 #endif
-    lv_label_set_text(label, "");
-    // WORK FINE!!!
-    // strncat(text, "CAPS", sizeof(text) - strlen(text) - 1);
-    // strncat(text, ".", sizeof(text) - strlen(text) - 1);
-
-    if (!hid_anim) { // Si no existe aún, creamos la animación
-
-      hid_anim = lv_animimg_create(label);
-      lv_obj_center(hid_anim);
-
-      // lv_animimg_set_src(hid_anim, (const void **)luna_imgs_bark_90, 10);
-      lv_animimg_set_src(hid_anim, (const void **)luna_imgs_bark_90, 2);
-      lv_animimg_set_duration(
-          hid_anim, CONFIG_NICE_OLED_WIDGET_HID_INDICATORS_LUNA_ANIMATION_MS);
-      lv_animimg_set_repeat_count(hid_anim, LV_ANIM_REPEAT_INFINITE);
-      lv_animimg_start(hid_anim);
-
-      lv_obj_align(hid_anim, LV_ALIGN_TOP_LEFT, 100, 15);
-      // lv_obj_align(hid_anim, LV_ALIGN_TOP_LEFT, 36, 0);
-      // lv_obj_align(hid_anim, LV_ALIGN_TOP_LEFT, 33, 3);
-    }
-  } else {
-    // Si LED_CLCK no está activo, y se había creado la animación, la eliminamos
-    if (hid_anim) {
-      lv_obj_del(hid_anim);
-      hid_anim = NULL;
-    }
-    lv_label_set_text(label, "");
-  }
-
-  // if (state.hid_indicators & LED_NLCK) {
-  // strncat(text, "NLCK", sizeof(text) - strlen(text) - 1);
-  // }
-  // if (state.hid_indicators & LED_SLCK) {
-  // strncat(text, "SLCK", sizeof(text) - strlen(text) - 1);
-  // }
-  // if (strlen(text) == 0) {
-  // strcpy(text, "");
-  // }
-
-  // 1. &custom_font_outline = white 2. &custom_font_shadow = black 3.
-  // &custom_font_44 = white &custom_font_44, &pixel_operator_mono_8,
-  // &pixel_operator_mono_12, &pixel_operator_mono
-  // lv_obj_set_style_text_font(label, &custom_font_22, LV_PART_MAIN |
-  // LV_STATE_DEFAULT); params: obj, align, y, x, default: 33, 11
-  // lv_obj_align(label, LV_ALIGN_OUT_TOP_LEFT, 30, -4); // big 44 words
-  // lv_obj_align(label, LV_ALIGN_OUT_TOP_LEFT, 30, 6); // big 22 words
-
-  // WORK FINE!!!
-  // lv_obj_set_style_text_font(label, &custom_font_44, LV_PART_MAIN |
-  // LV_STATE_DEFAULT); lv_label_set_text(label, text); lv_obj_align(label,
-  // LV_ALIGN_OUT_TOP_LEFT, 3, -4); // big point
+
+  luna_sprite_set(LUNA_SPRITE_HID_INDICATORS, bark ? &luna_clip_bark : NULL);
 }
 
 void hid_indicators_update_cb(struct hid_indicators_state state) {
-  struct zmk_widget_hid_indicators *widget;
-  SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
-    set_hid_indicators(widget->obj, state);
-  }
+  set_hid_indicators(state);
 }
 
 static struct hid_indicators_state
@@ -160,9 +103,8 @@ ZMK_SUBSCRIPTION(widget_hid_indicators, zmk_hid_indicators_changed);
 
 int zmk_widget_hid_indicators_init(struct zmk_widget_hid_indicators *widget,
                                    lv_obj_t *parent) {
-  widget->obj = lv_label_create(parent);
-
-  sys_slist_append(&widgets, &widget->node);
+  widget->obj = luna_sprite_create(parent);
+  lv_obj_align(widget->obj, LV_ALIGN_TOP_LEFT, 100, 15);
 
   widget_hid_indicators_init();
 
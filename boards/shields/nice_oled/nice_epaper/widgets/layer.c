@@ -1,6 +1,6 @@
 #include <zephyr/kernel.h>
 #include "layer.h"
-#include "../assets/custom_fonts.h"
+#include "../../assets/custom_fonts.h"
 
 void draw_layer_status(lv_obj_t *canvas, const struct status_state *state) {
     lv_draw_label_dsc_t label_dsc;
@@ -16,5 +16,5 @@ void draw_layer_status(lv_obj_t *canvas, const struct status_state *state) {
         to_uppercase(text);
     }
 
-    lv_canvas_draw_text(canvas, 0, 146, 68, &label_dsc, text);
+    canvas_draw_text(canvas, 0, 146, 68, &label_dsc, text);
 }
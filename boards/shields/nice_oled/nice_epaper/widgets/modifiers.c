@@ -16,13 +16,12 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <dt-bindings/zmk/modifiers.h>
 
 #include "modifiers.h"
+#include "../../widgets/luna_sprite.h"
 
 struct modifiers_state {
     uint8_t modifiers;
 };
 
-static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
-
 /**
  * Construye el string que representa los modificadores activos.
  * Se utiliza el siguiente mapeo:
@@ -38,16 +37,16 @@ static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 static void set_modifiers_text(lv_obj_t *label, struct modifiers_state state) {
     char text[16] = {0};
 
-    if (state.modifiers & (MOD_LGUI | MOD_RGUI)) {
+    if (mods & (MOD_LGUI | MOD_RGUI)) {
         strcat(text, "M");
     }
-    if (state.modifiers & (MOD_LALT | MOD_RALT)) {
+    if (mods & (MOD_LALT | MOD_RALT)) {
         strcat(text, "A");
     }
-    if (state.modifiers & (MOD_LCTL | MOD_RCTL)) {
+    if (mods & (MOD_LCTL | MOD_RCTL)) {
         strcat(text, "C");
     }
-    if (state.modifiers & (MOD_LSFT | MOD_RSFT)) {
+    if (mods & (MOD_LSFT | MOD_RSFT)) {
         strcat(text, "S");
     }
 
@@ -69,100 +68,49 @@ const lv_img_dsc_t *luna_imgs_walk_90[] = {&dog_walk1_90, &dog_walk2_90};
 const lv_img_dsc_t *luna_imgs_run_90[] = {&dog_run1_90, &dog_run2_90};
 const lv_img_dsc_t *luna_imgs_sneak_90[] = {&dog_sneak1_90, &dog_sneak2_90};
 
-static lv_obj_t *luna_imgs = NULL; // Variable estática para almacenar el objeto animado
+#define ANIMATION_MS CONFIG_NICE_OLED_WIDGET_MODIFIERS_INDICATORS_LUNA_ANIMATION_MS
 
-static void set_modifiers_text(lv_obj_t *label, struct modifiers_state ignored) {
-    // LUNA:
-    // - sneak: LSFT, RSFT
-    // - run:  LCTL, RCTL
-    // - gasp:   LGUI, RGUI
-    // - walk: LALT, RALT
-    // Consultamos el estado actual de los modificadores
-    uint8_t mods = zmk_hid_get_explicit_mods();
+static const struct luna_sprite_clip luna_clip_sit =
+    LUNA_SPRITE_CLIP(luna_imgs_sit_90, ANIMATION_MS);
+static const struct luna_sprite_clip luna_clip_walk =
+    LUNA_SPRITE_CLIP(luna_imgs_walk_90, ANIMATION_MS);
+static const struct luna_sprite_clip luna_clip_run =
+    LUNA_SPRITE_CLIP(luna_imgs_run_90, ANIMATION_MS);
+static const struct luna_sprite_clip luna_clip_sneak =
+    LUNA_SPRITE_CLIP(luna_imgs_sneak_90, ANIMATION_MS);
 
-    // char text[16] = {0};
-    lv_label_set_text(label, "");
+static void set_modifiers(uint8_t mods) {
+    const struct luna_sprite_clip *clip = NULL;
 
     if (mods & (MOD_LGUI | MOD_RGUI)) {
-        // strcat(text, "M");
-
-        if (!luna_imgs) { // Si no existe aún, creamos la animación
-
-            luna_imgs = lv_animimg_create(label);
-            lv_obj_center(luna_imgs);
-
-            // lv_animimg_set_src(luna_imgs, (const void **)luna_imgs_bark_90, 10);
-            lv_animimg_set_src(luna_imgs, (const void **)luna_imgs_sit_90, 2);
-            lv_animimg_set_duration(luna_imgs,
-                                    CONFIG_NICE_OLED_WIDGET_MODIFIERS_INDICATORS_LUNA_ANIMATION_MS);
-            lv_animimg_set_repeat_count(luna_imgs, LV_ANIM_REPEAT_INFINITE);
-            lv_animimg_start(luna_imgs);
-            lv_obj_align(luna_imgs, LV_ALIGN_TOP_LEFT, 100, 15);
-        }
+        clip = &luna_clip_sit;
     } else if (mods & (MOD_LALT | MOD_RALT)) {
-        // strcat(text, "A");
-        if (!luna_imgs) { // Si no existe aún, creamos la animación
-
-            luna_imgs = lv_animimg_create(label);
-            lv_obj_center(luna_imgs);
-
-            // lv_animimg_set_src(luna_imgs, (const void **)luna_imgs_bark_90, 10);
-            lv_animimg_set_src(luna_imgs, (const void **)luna_imgs_walk_90, 2);
-            lv_animimg_set_duration(luna_imgs,
-                                    CONFIG_NICE_OLED_WIDGET_MODIFIERS_INDICATORS_LUNA_ANIMATION_MS);
-            lv_animimg_set_repeat_count(luna_imgs, LV_ANIM_REPEAT_INFINITE);
-            lv_animimg_start(luna_imgs);
-            lv_obj_align(luna_imgs, LV_ALIGN_TOP_LEFT, 100, 15);
-        }
+        clip = &luna_clip_walk;
     } else if (mods & (MOD_LCTL | MOD_RCTL)) {
-        // strcat(text, "C");
-        if (!luna_imgs) { // Si no existe aún, creamos la animación
-
-            luna_imgs = lv_animimg_create(label);
-            lv_obj_center(luna_imgs);
-
-            // lv_animimg_set_src(luna_imgs, (const void **)luna_imgs_bark_90, 10);
-            lv_animimg_set_src(luna_imgs, (const void **)luna_imgs_run_90, 2);
-            lv_animimg_set_duration(luna_imgs,
-                                    CONFIG_NICE_OLED_WIDGET_MODIFIERS_INDICATORS_LUNA_ANIMATION_MS);
-            lv_animimg_set_repeat_count(luna_imgs, LV_ANIM_REPEAT_INFINITE);
-            lv_animimg_start(luna_imgs);
-            lv_obj_align(luna_imgs, LV_ALIGN_TOP_LEFT, 100, 15);
-        }
+        clip = &luna_clip_run;
     } else if (mods & (MOD_LSFT | MOD_RSFT)) {
-        // strcat(text, "S");
-        if (!luna_imgs) { // Si no existe aún, creamos la animación
-
-            luna_imgs = lv_animimg_create(label);
-            lv_obj_center(luna_imgs);
-
-            // lv_animimg_set_src(luna_imgs, (const void **)luna_imgs_bark_90, 10);
-            lv_animimg_set_src(luna_imgs, (const void **)luna_imgs_sneak_90, 2);
-            lv_animimg_set_duration(luna_imgs,
-                                    CONFIG_NICE_OLED_WIDGET_MODIFIERS_INDICATORS_LUNA_ANIMATION_MS);
-            lv_animimg_set_repeat_count(luna_imgs, LV_ANIM_REPEAT_INFINITE);
-            lv_animimg_start(luna_imgs);
-            // lv_obj_align(luna_imgs, LV_ALIGN_TOP_LEFT, 36, 0);
-            lv_obj_align(luna_imgs, LV_ALIGN_TOP_LEFT, 100, 15);
-        }
-    } else {
-        if (luna_imgs) {
-            lv_obj_del(luna_imgs);
-            luna_imgs = NULL;
-        }
+        clip = &luna_clip_sneak;
     }
 
-    // lv_label_set_text(label, text);
-    // params: obj, align, x, y
-    // lv_obj_align(label, LV_ALIGN_OUT_TOP_LEFT, 33, 11); // WORK FINE!!
+    luna_sprite_set(LUNA_SPRITE_MODIFIERS, clip);
 }
 
 /**
  * Callback de actualización del widget, se invoca al cambiar el estado de los modificadores.
  */
+// Explicit modifiers the sprite shows
+static uint8_t shown_mods;
+
 static void modifiers_update_cb(struct modifiers_state state) {
-    struct zmk_widget_modifiers *widget;
-    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_modifiers_text(widget->obj, state); }
+    // Read when the work runs, after hid_listener has applied the key
+    uint8_t mods = zmk_hid_get_explicit_mods();
+
+    if (mods == shown_mods) {
+        return;
+    }
+
+    shown_mods = mods;
+    set_modifiers(mods);
 }
 
 /**
@@ -178,7 +126,25 @@ static struct modifiers_state modifiers_get_state(const zmk_event_t *eh) {
 /* Registra el listener para actualizar el widget cuando cambie el estado de los modificadores */
 ZMK_DISPLAY_WIDGET_LISTENER(widget_modifiers, struct modifiers_state, modifiers_update_cb,
                             modifiers_get_state)
-ZMK_SUBSCRIPTION(widget_modifiers, zmk_keycode_state_changed);
+
+/*
+ * Most keycode events are not modifier keys, and cannot change the explicit
+ * modifiers. Only modifier keys reach the widget_modifiers_cb() defined by
+ * ZMK_DISPLAY_WIDGET_LISTENER, so other keys queue no display work.
+ */
+static int modifiers_keycode_listener(const zmk_event_t *eh) {
+    const struct zmk_keycode_state_changed *ev =
+        as_zmk_keycode_state_changed(eh);
+
+    if (ev == NULL || !is_mod(ev->usage_page, ev->keycode)) {
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    return widget_modifiers_cb(eh);
+}
+
+ZMK_LISTENER(widget_modifiers_keycode, modifiers_keycode_listener);
+ZMK_SUBSCRIPTION(widget_modifiers_keycode, zmk_keycode_state_changed);
 
 /**
  * Inicializa el widget de modificadores.
@@ -189,8 +155,8 @@ ZMK_SUBSCRIPTION(widget_modifiers, zmk_keycode_state_changed);
  * @return 0 si la inicialización fue exitosa.
  */
 int zmk_widget_modifiers_init(struct zmk_widget_modifiers *widget, lv_obj_t *parent) {
-    widget->obj = lv_label_create(parent);
-    sys_slist_append(&widgets, &widget->node);
+    widget->obj = luna_sprite_create(parent);
+    lv_obj_align(widget->obj, LV_ALIGN_TOP_LEFT, 100, 15);
     widget_modifiers_init();
     return 0;
 }
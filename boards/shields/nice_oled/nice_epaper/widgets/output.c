@@ -1,6 +1,6 @@
 #include <zephyr/kernel.h>
 #include "output.h"
-#include "../assets/custom_fonts.h"
+#include "../../assets/custom_fonts.h"
 
 LV_IMG_DECLARE(bt_no_signal);
 LV_IMG_DECLARE(bt_unbonded);
@@ -12,14 +12,14 @@ static void draw_usb_connected(lv_obj_t *canvas) {
     lv_draw_img_dsc_t img_dsc;
     lv_draw_img_dsc_init(&img_dsc);
 
-    lv_canvas_draw_img(canvas, 45, 2, &usb, &img_dsc);
+    canvas_draw_img(canvas, 45, 2, &usb, &img_dsc);
 }
 
 static void draw_ble_unbonded(lv_obj_t *canvas) {
     lv_draw_img_dsc_t img_dsc;
     lv_draw_img_dsc_init(&img_dsc);
 
-    lv_canvas_draw_img(canvas, 44, 0, &bt_unbonded, &img_dsc);
+    canvas_draw_img(canvas, 44, 0, &bt_unbonded, &img_dsc);
 }
 #endif
 
@@ -27,24 +27,24 @@ static void draw_ble_disconnected(lv_obj_t *canvas) {
     lv_draw_img_dsc_t img_dsc;
     lv_draw_img_dsc_init(&img_dsc);
 
-    lv_canvas_draw_img(canvas, 49, 0, &bt_no_signal, &img_dsc);
+    canvas_draw_img(canvas, 49, 0, &bt_no_signal, &img_dsc);
 }
 
 static void draw_ble_connected(lv_obj_t *canvas) {
     lv_draw_img_dsc_t img_dsc;
     lv_draw_img_dsc_init(&img_dsc);
 
-    lv_canvas_draw_img(canvas, 49, 0, &bt, &img_dsc);
+    canvas_draw_img(canvas, 49, 0, &bt, &img_dsc);
 }
 
 void draw_output_status(lv_obj_t *canvas, const struct status_state *state) {
     lv_draw_label_dsc_t label_dsc;
     init_label_dsc(&label_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_LEFT);
-    lv_canvas_draw_text(canvas, 0, 1, 25, &label_dsc, "SIG");
+    canvas_draw_text(canvas, 0, 1, 25, &label_dsc, "SIG");
 
     lv_draw_rect_dsc_t rect_white_dsc;
     init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
-    lv_canvas_draw_rect(canvas, 43, 0, 24, 15, &rect_white_dsc);
+    canvas_draw_rect(canvas, 43, 0, 24, 15, &rect_white_dsc);
 
 #if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
     switch (state->selected_endpoint.transport) {
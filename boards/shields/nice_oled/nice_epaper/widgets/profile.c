@@ -7,7 +7,7 @@ static void draw_inactive_profiles(lv_obj_t *canvas, const struct status_state *
     lv_draw_img_dsc_t img_dsc;
     lv_draw_img_dsc_init(&img_dsc);
 
-    lv_canvas_draw_img(canvas, 18, 129, &profiles, &img_dsc);
+    canvas_draw_img(canvas, 18, 129, &profiles, &img_dsc);
 }
 
 static void draw_active_profile(lv_obj_t *canvas, const struct status_state *state) {
@@ -16,7 +16,7 @@ static void draw_active_profile(lv_obj_t *canvas, const struct status_state *sta
 
     int offset = state->active_profile_index * 7;
 
-    lv_canvas_draw_rect(canvas, 18 + offset, 129, 3, 3, &rect_white_dsc);
+    canvas_draw_rect(canvas, 18 + offset, 129, 3, 3, &rect_white_dsc);
 }
 
 void draw_profile_status(lv_obj_t *canvas, const struct status_state *state) {
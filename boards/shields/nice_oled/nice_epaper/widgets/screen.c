@@ -22,6 +22,7 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include "layer.h"
 #include "output.h"
 #include "profile.h"
+#include "../../widgets/render_stats.h"
 #include "screen.h"
 #include "wpm.h"
 
@@ -57,22 +58,27 @@ static struct zmk_widget_hid_indicators hid_indicators_widget;
  * Draw canvas
  **/
 
-static void draw_canvas(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
+static void draw_canvas(lv_obj_t *widget, const struct status_state *state) {
     lv_obj_t *canvas = lv_obj_get_child(widget, 0);
 
-    // Draw widgets
-    draw_background(canvas);
-    draw_output_status(canvas, state);
+    render_stats_frame_begin();
+
+    // Draw widgets, already rotated for horizontal display
+    RENDER_STATS_MEASURE(RENDER_STATS_BACKGROUND, draw_background(canvas));
+    RENDER_STATS_MEASURE(RENDER_STATS_OUTPUT, draw_output_status(canvas, state));
     // TODO: charging animation START
     // change the position
-    draw_wpm_status(canvas, state);
-    draw_battery_status(canvas, state);
+    RENDER_STATS_MEASURE(RENDER_STATS_WPM, draw_wpm_status(canvas, state));
+    RENDER_STATS_MEASURE(RENDER_STATS_BATTERY, draw_battery_status(canvas, state));
     // TODO: charging animation END
-    draw_profile_status(canvas, state);
-    draw_layer_status(canvas, state);
+    RENDER_STATS_MEASURE(RENDER_STATS_PROFILE, draw_profile_status(canvas, state));
+    RENDER_STATS_MEASURE(RENDER_STATS_LAYER, draw_layer_status(canvas, state));
+
+#if IS_ENABLED(CONFIG_NICE_EPAPER_LINE_FLUSH)
+    canvas_flush_pages(canvas);
+#endif
 
-    // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+    render_stats_frame_end();
 }
 
 /**
@@ -87,7 +93,7 @@ static void set_battery_status(struct zmk_widget_screen *widget,
 
     widget->state.battery = state.level;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    draw_canvas(widget->obj, &widget->state);
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
@@ -122,7 +128,7 @@ static void set_layer_status(struct zmk_widget_screen *widget, struct layer_stat
     widget->state.layer_index = state.index;
     widget->state.layer_label = state.label;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    draw_canvas(widget->obj, &widget->state);
 }
 
 static void layer_status_update_cb(struct layer_status_state state) {
@@ -151,7 +157,7 @@ static void set_output_status(struct zmk_widget_screen *widget,
     widget->state.active_profile_connected = state->active_profile_connected;
     widget->state.active_profile_bonded = state->active_profile_bonded;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    draw_canvas(widget->obj, &widget->state);
 }
 
 static void output_status_update_cb(struct output_status_state state) {
@@ -189,7 +195,7 @@ static void set_wpm_status(struct zmk_widget_screen *widget, struct wpm_status_s
     }
     widget->state.wpm[9] = state.wpm;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    draw_canvas(widget->obj, &widget->state);
 }
 
 static void wpm_status_update_cb(struct wpm_status_state state) {
@@ -215,7 +221,12 @@ int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent) {
 
     lv_obj_t *canvas = lv_canvas_create(widget->obj);
     lv_obj_align(canvas, LV_ALIGN_TOP_LEFT, 0, 0);
-    lv_canvas_set_buffer(canvas, widget->cbuf, CANVAS_HEIGHT, CANVAS_HEIGHT, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_set_buffer(canvas, widget->cbuf, CANVAS_HEIGHT, CANVAS_WIDTH, LV_IMG_CF_INDEXED_1BIT);
+    lv_canvas_set_palette(canvas, 0, LVGL_BACKGROUND);
+    lv_canvas_set_palette(canvas, 1, LVGL_FOREGROUND);
+#if IS_ENABLED(CONFIG_NICE_EPAPER_LINE_FLUSH)
+    canvas_track_lines(canvas, widget->shadow);
+#endif
 
     sys_slist_append(&widgets, &widget->node);
     widget_battery_status_init();
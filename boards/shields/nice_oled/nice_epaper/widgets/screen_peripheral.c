@@ -16,6 +16,7 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include "animation.h"
 #include "battery.h"
 #include "output.h"
+#include "../../widgets/render_stats.h"
 #include "screen_peripheral.h"
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
@@ -24,16 +25,21 @@ static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
  * Draw canvas
  **/
 
-static void draw_canvas(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
+static void draw_canvas(lv_obj_t *widget, const struct status_state *state) {
     lv_obj_t *canvas = lv_obj_get_child(widget, 0);
 
-    // Draw widgets
-    draw_background(canvas);
-    draw_output_status(canvas, state);
-    draw_battery_status(canvas, state);
+    render_stats_frame_begin();
 
-    // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+    // Draw widgets, already rotated for horizontal display
+    RENDER_STATS_MEASURE(RENDER_STATS_BACKGROUND, draw_background(canvas));
+    RENDER_STATS_MEASURE(RENDER_STATS_OUTPUT, draw_output_status(canvas, state));
+    RENDER_STATS_MEASURE(RENDER_STATS_BATTERY, draw_battery_status(canvas, state));
+
+#if IS_ENABLED(CONFIG_NICE_EPAPER_LINE_FLUSH)
+    canvas_flush_pages(canvas);
+#endif
+
+    render_stats_frame_end();
 }
 
 /**
@@ -48,7 +54,7 @@ static void set_battery_status(struct zmk_widget_screen *widget,
 
     widget->state.battery = state.level;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    draw_canvas(widget->obj, &widget->state);
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
@@ -87,7 +93,7 @@ static void set_connection_status(struct zmk_widget_screen *widget,
                                   struct peripheral_status_state state) {
     widget->state.connected = state.connected;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    draw_canvas(widget->obj, &widget->state);
 }
 
 static void output_status_update_cb(struct peripheral_status_state state) {
@@ -109,7 +115,12 @@ int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent) {
 
     lv_obj_t *canvas = lv_canvas_create(widget->obj);
     lv_obj_align(canvas, LV_ALIGN_TOP_LEFT, 0, 0);
-    lv_canvas_set_buffer(canvas, widget->cbuf, CANVAS_HEIGHT, CANVAS_HEIGHT, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_set_buffer(canvas, widget->cbuf, CANVAS_HEIGHT, CANVAS_WIDTH, LV_IMG_CF_INDEXED_1BIT);
+    lv_canvas_set_palette(canvas, 0, LVGL_BACKGROUND);
+    lv_canvas_set_palette(canvas, 1, LVGL_FOREGROUND);
+#if IS_ENABLED(CONFIG_NICE_EPAPER_LINE_FLUSH)
+    canvas_track_lines(canvas, widget->shadow);
+#endif
 
     draw_animation(canvas, widget);
 
@@ -7,7 +7,11 @@
 struct zmk_widget_screen {
     sys_snode_t node;
     lv_obj_t *obj;
-    lv_color_t cbuf[CANVAS_HEIGHT * CANVAS_HEIGHT];
+    uint8_t cbuf[CANVAS_BUF_SIZE(CANVAS_HEIGHT, CANVAS_WIDTH)];
+#if IS_ENABLED(CONFIG_NICE_EPAPER_LINE_FLUSH)
+    // What the panel shows, to send only the lines that change
+    uint8_t shadow[CANVAS_BUF_SIZE(CANVAS_HEIGHT, CANVAS_WIDTH)];
+#endif
     struct status_state state;
 };
 
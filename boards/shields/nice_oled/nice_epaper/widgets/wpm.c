@@ -1,7 +1,7 @@
-#include <math.h>
 #include <zephyr/kernel.h>
 #include "wpm.h"
-#include "../assets/custom_fonts.h"
+#include "../../widgets/needle.h"
+#include "../../assets/custom_fonts.h"
 
 LV_IMG_DECLARE(gauge);
 LV_IMG_DECLARE(grid);
@@ -12,46 +12,47 @@ static void draw_gauge(lv_obj_t *canvas, const struct status_state *state) {
     lv_draw_img_dsc_t img_dsc;
     lv_draw_img_dsc_init(&img_dsc);
 
-    lv_canvas_draw_img(canvas, 16, 43, &gauge, &img_dsc);
+    canvas_draw_img(canvas, 16, 43, &gauge, &img_dsc);
 }
 
-static void draw_needle(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_line_dsc_t line_dsc;
-    init_line_dsc(&line_dsc, LVGL_FOREGROUND, 1);
-
-    int centerX = 33;
-    int centerY = 66;
-    int offset = 13;
-    int value = state->wpm[9];
+#define NEEDLE_X 33
+#define NEEDLE_Y 66
+#define NEEDLE_OFFSET 13
+#define NEEDLE_RADIUS 25.45585
 
 #if IS_ENABLED(CONFIG_NICE_OLED_GEM_WPM_FIXED_RANGE)
-    float max = CONFIG_NICE_OLED_GEM_WPM_FIXED_RANGE_MAX;
+#define NEEDLE_MAX CONFIG_NICE_OLED_GEM_WPM_FIXED_RANGE_MAX
+
+static const struct needle needles[NEEDLE_MAX + 1] = {
+    LISTIFY(UTIL_INC(NEEDLE_MAX), NEEDLE_ENTRY, (, ), NEEDLE_MAX, NEEDLE_OFFSET, NEEDLE_RADIUS)};
+
+static struct needle get_needle(const struct status_state *state) {
+    return needles[MIN(state->wpm[9], NEEDLE_MAX)];
+}
 #else
-    float max = 0;
+static struct needle get_needle(const struct status_state *state) {
+    int max = 0;
     for (int i = 0; i < 10; i++) {
         if (state->wpm[i] > max) {
             max = state->wpm[i];
         }
     }
-#endif
-    if (max == 0)
+    if (max == 0) {
         max = 100;
-    if (value < 0)
-        value = 0;
-    if (value > max)
-        value = max;
-
-    float radius = 25.45585;
-    float angleDeg = 225 + ((float)value / max) * 90;
-    float angleRad = angleDeg * (3.14159 / 180.0f);
-
-    int needleStartX = centerX + (int)(offset * cos(angleRad));
-    int needleStartY = centerY + (int)(offset * sin(angleRad));
-    int needleEndX = centerX + (int)(radius * cos(angleRad));
-    int needleEndY = centerY + (int)(radius * sin(angleRad));
-
-    lv_point_t points[2] = {{needleStartX, needleStartY}, {needleEndX, needleEndY}};
-    lv_canvas_draw_line(canvas, points, 2, &line_dsc);
+    }
+
+    return needle_get(state->wpm[9], max, NEEDLE_OFFSET, NEEDLE_RADIUS_Q8(NEEDLE_RADIUS));
+}
+#endif
+
+static void draw_needle(lv_obj_t *canvas, const struct status_state *state) {
+    lv_draw_line_dsc_t line_dsc;
+    init_line_dsc(&line_dsc, LVGL_FOREGROUND, 1);
+
+    struct needle needle = get_needle(state);
+    lv_point_t points[2] = {{NEEDLE_X + needle.x1, NEEDLE_Y + needle.y1},
+                            {NEEDLE_X + needle.x2, NEEDLE_Y + needle.y2}};
+    canvas_draw_line(canvas, points, 2, &line_dsc);
 }
 #endif
 
@@ -59,7 +60,7 @@ static void draw_grid(lv_obj_t *canvas) {
     lv_draw_img_dsc_t img_dsc;
     lv_draw_img_dsc_init(&img_dsc);
 
-    lv_canvas_draw_img(canvas, 0, 65, &grid, &img_dsc);
+    canvas_draw_img(canvas, 0, 65, &grid, &img_dsc);
 }
 
 static void draw_graph(lv_obj_t *canvas, const struct status_state *state) {
@@ -106,13 +107,13 @@ static void draw_graph(lv_obj_t *canvas, const struct status_state *state) {
     }
 #endif
 
-    lv_canvas_draw_line(canvas, points, 10, &line_dsc);
+    canvas_draw_line(canvas, points, 10, &line_dsc);
 }
 
 static void draw_label(lv_obj_t *canvas, const struct status_state *state) {
     lv_draw_label_dsc_t label_left_dsc;
     init_label_dsc(&label_left_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_LEFT);
-    lv_canvas_draw_text(canvas, 0, 103, 25, &label_left_dsc, "WPM");
+    canvas_draw_text(canvas, 0, 103, 25, &label_left_dsc, "WPM");
 
     lv_draw_label_dsc_t label_dsc_wpm;
     init_label_dsc(&label_dsc_wpm, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_RIGHT);
@@ -120,7 +121,7 @@ static void draw_label(lv_obj_t *canvas, const struct status_state *state) {
     char wpm_text[6] = {};
 
     snprintf(wpm_text, sizeof(wpm_text), "%d", state->wpm[9]);
-    lv_canvas_draw_text(canvas, 26, 103, 42, &label_dsc_wpm, wpm_text);
+    canvas_draw_text(canvas, 26, 103, 42, &label_dsc_wpm, wpm_text);
 }
 
 void draw_wpm_status(lv_obj_t *canvas, const struct status_state *state) {
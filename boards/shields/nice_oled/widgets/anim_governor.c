@@ -0,0 +1,106 @@
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/activity.h>
+#include <zmk/battery.h>
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
+#include <zmk/events/battery_state_changed.h>
+#include <zmk/events/usb_conn_state_changed.h>
+#include <zmk/usb.h>
+
+#include "anim_governor.h"
+
+static sys_slist_t listeners = SYS_SLIST_STATIC_INIT(&listeners);
+
+// Frames per second allowed right now, 0 while paused
+static uint8_t max_fps = CONFIG_NICE_OLED_ANIMATION_FPS_USB;
+
+struct anim_governor_state {
+    bool active;
+    bool usb_powered;
+    uint8_t battery;
+};
+
+static uint8_t get_max_fps(struct anim_governor_state state) {
+    if (!state.active) {
+        // Nothing is shown while the display is blanked
+        return IS_ENABLED(CONFIG_ZMK_DISPLAY_BLANK_ON_IDLE) ? 0
+                                                            : CONFIG_NICE_OLED_ANIMATION_FPS_IDLE;
+    }
+    if (state.usb_powered) {
+        return CONFIG_NICE_OLED_ANIMATION_FPS_USB;
+    }
+    if (state.battery < CONFIG_NICE_OLED_ANIMATION_LOW_BATTERY_LEVEL) {
+        return CONFIG_NICE_OLED_ANIMATION_FPS_LOW_BATTERY;
+    }
+    return CONFIG_NICE_OLED_ANIMATION_FPS_BATTERY;
+}
+
+static void anim_governor_update_cb(struct anim_governor_state state) {
+    uint8_t fps = get_max_fps(state);
+
+    if (fps == max_fps) {
+        return;
+    }
+
+    LOG_DBG("Animations limited to %d fps", fps);
+    max_fps = fps;
+
+    struct anim_governor_listener *listener, *next;
+    SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&listeners, listener, next, node) {
+        listener->changed(listener);
+    }
+}
+
+static struct anim_governor_state anim_governor_get_state(const zmk_event_t *eh) {
+    const struct zmk_activity_state_changed *activity_ev = as_zmk_activity_state_changed(eh);
+    const struct zmk_battery_state_changed *battery_ev = as_zmk_battery_state_changed(eh);
+
+    return (struct anim_governor_state){
+        .active = (activity_ev != NULL ? activity_ev->state : zmk_activity_get_state()) ==
+                  ZMK_ACTIVITY_ACTIVE,
+#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+        .usb_powered = zmk_usb_is_powered(),
+#endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
+        .battery = battery_ev != NULL ? battery_ev->state_of_charge : zmk_battery_state_of_charge(),
+    };
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(anim_governor, struct anim_governor_state, anim_governor_update_cb,
+                            anim_governor_get_state)
+
+ZMK_SUBSCRIPTION(anim_governor, zmk_activity_state_changed);
+ZMK_SUBSCRIPTION(anim_governor, zmk_battery_state_changed);
+#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+ZMK_SUBSCRIPTION(anim_governor, zmk_usb_conn_state_changed);
+#endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
+
+void anim_governor_add(struct anim_governor_listener *listener) {
+    static bool initialized;
+
+    sys_slist_append(&listeners, &listener->node);
+
+    // The first animation picks up the current state
+    if (!initialized) {
+        initialized = true;
+        anim_governor_init();
+    }
+
+    listener->changed(listener);
+}
+
+void anim_governor_remove(struct anim_governor_listener *listener) {
+    sys_slist_find_and_remove(&listeners, &listener->node);
+}
+
+uint32_t anim_governor_period(uint32_t period) {
+    if (max_fps == 0) {
+        return 0;
+    }
+
+    return MAX(period, 1000 / max_fps);
+}
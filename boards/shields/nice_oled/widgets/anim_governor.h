@@ -0,0 +1,45 @@
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+/*
+ * Power-aware frame rate limit for the animations.
+ *
+ * The governor follows the activity state, USB power and the battery level,
+ * and caps every animation at the frame rate set for the current mode:
+ *
+ *   idle         CONFIG_NICE_OLED_ANIMATION_FPS_IDLE
+ *   USB powered  CONFIG_NICE_OLED_ANIMATION_FPS_USB
+ *   battery      CONFIG_NICE_OLED_ANIMATION_FPS_BATTERY
+ *   low battery  CONFIG_NICE_OLED_ANIMATION_FPS_LOW_BATTERY, below
+ *                CONFIG_NICE_OLED_ANIMATION_LOW_BATTERY_LEVEL percent
+ *
+ * A rate of 0 pauses the animations on their current frame, which is also
+ * what happens while CONFIG_ZMK_DISPLAY_BLANK_ON_IDLE blanks the display.
+ * Listeners are called from the display work queue whenever the limit
+ * changes, and ask anim_governor_period() for their new frame period.
+ */
+
+struct anim_governor_listener {
+    sys_snode_t node;
+    void (*changed)(struct anim_governor_listener *listener);
+};
+
+#if IS_ENABLED(CONFIG_NICE_OLED_ANIMATION_GOVERNOR)
+// Start following the limit, calling changed() once with the current one
+void anim_governor_add(struct anim_governor_listener *listener);
+void anim_governor_remove(struct anim_governor_listener *listener);
+
+// Frame period in ms for an animation made to run at period ms per frame,
+// or 0 while animations are paused
+uint32_t anim_governor_period(uint32_t period);
+#else
+static inline void anim_governor_add(struct anim_governor_listener *listener) {
+    ARG_UNUSED(listener);
+}
+static inline void anim_governor_remove(struct anim_governor_listener *listener) {
+    ARG_UNUSED(listener);
+}
+static inline uint32_t anim_governor_period(uint32_t period) { return period; }
+#endif
@@ -1,63 +1,15 @@
 #include "animation.h"
 #include "screen_peripheral.h"
-// TODO: (Feature request) Disable animation when on battery #4
-// #include "../assets/custom_fonts.h"
-// #include "battery.h"
 #include <stdlib.h>
 #include <zephyr/kernel.h>
 
+#include "delta_anim.h"
+
 // CONFIG_NICE_OLED_GEM_ANIMATION
-LV_IMG_DECLARE(crystal_01);
-LV_IMG_DECLARE(crystal_02);
-LV_IMG_DECLARE(crystal_03);
-LV_IMG_DECLARE(crystal_04);
-LV_IMG_DECLARE(crystal_05);
-LV_IMG_DECLARE(crystal_06);
-LV_IMG_DECLARE(crystal_07);
-LV_IMG_DECLARE(crystal_08);
-LV_IMG_DECLARE(crystal_09);
-LV_IMG_DECLARE(crystal_10);
-LV_IMG_DECLARE(crystal_11);
-LV_IMG_DECLARE(crystal_12);
-LV_IMG_DECLARE(crystal_13);
-LV_IMG_DECLARE(crystal_14);
-LV_IMG_DECLARE(crystal_15);
-LV_IMG_DECLARE(crystal_16);
-
-const lv_img_dsc_t *crystal_imgs[] = {
-    &crystal_01, &crystal_02, &crystal_03, &crystal_04, &crystal_05, &crystal_06,
-    &crystal_07, &crystal_08, &crystal_09, &crystal_10, &crystal_11, &crystal_12,
-    &crystal_13, &crystal_14, &crystal_15, &crystal_16,
-};
+extern const struct delta_anim crystal_anim;
 
 // CONFIG_NICE_OLED_POKEMON_ANIMATION
-// 01 to 20
-LV_IMG_DECLARE(pokemon01);
-LV_IMG_DECLARE(pokemon02);
-LV_IMG_DECLARE(pokemon03);
-LV_IMG_DECLARE(pokemon04);
-LV_IMG_DECLARE(pokemon05);
-LV_IMG_DECLARE(pokemon06);
-LV_IMG_DECLARE(pokemon07);
-LV_IMG_DECLARE(pokemon08);
-LV_IMG_DECLARE(pokemon09);
-LV_IMG_DECLARE(pokemon10);
-LV_IMG_DECLARE(pokemon11);
-LV_IMG_DECLARE(pokemon12);
-LV_IMG_DECLARE(pokemon13);
-LV_IMG_DECLARE(pokemon14);
-LV_IMG_DECLARE(pokemon15);
-LV_IMG_DECLARE(pokemon16);
-LV_IMG_DECLARE(pokemon17);
-LV_IMG_DECLARE(pokemon18);
-LV_IMG_DECLARE(pokemon19);
-LV_IMG_DECLARE(pokemon20);
-
-const lv_img_dsc_t *pokemon_imgs[] = {
-    &pokemon01, &pokemon02, &pokemon03, &pokemon04, &pokemon05, &pokemon06, &pokemon07,
-    &pokemon08, &pokemon09, &pokemon10, &pokemon11, &pokemon12, &pokemon13, &pokemon14,
-    &pokemon15, &pokemon16, &pokemon17, &pokemon18, &pokemon19, &pokemon20,
-};
+extern const struct delta_anim pokemon_anim;
 
 // CONFIG_NICE_OLED_VIM
 LV_IMG_DECLARE(vim);
@@ -71,6 +23,14 @@ LV_IMG_DECLARE(vip_marcos);
 void draw_animation(lv_obj_t *canvas, struct zmk_widget_screen *widget) {}
 #else
 
+// Frames are decoded one at a time into this buffer
+static struct delta_anim_player player;
+#if IS_ENABLED(CONFIG_NICE_OLED_POKEMON_ANIMATION) && !IS_ENABLED(CONFIG_NICE_OLED_GEM_ANIMATION)
+static uint8_t frame_buf[DELTA_ANIM_BUF_SIZE(140, 68)];
+#else
+static uint8_t frame_buf[DELTA_ANIM_BUF_SIZE(69, 68)];
+#endif
+
 void draw_animation(lv_obj_t *canvas, struct zmk_widget_screen *widget) {
     /* Declare globally within the function, so that they exist regardless of
      * #if. */
@@ -78,38 +38,33 @@ void draw_animation(lv_obj_t *canvas, struct zmk_widget_screen *widget) {
     lv_obj_t *art2 = NULL;
 
 #if IS_ENABLED(CONFIG_NICE_OLED_GEM_ANIMATION)
-    art = lv_animimg_create(widget->obj);
+    delta_anim_init(&player, &crystal_anim, frame_buf, LVGL_BACKGROUND, LVGL_FOREGROUND);
+    art = delta_anim_create(widget->obj, &player, CONFIG_NICE_OLED_GEM_ANIMATION_MS);
     lv_obj_center(art);
 
-    lv_animimg_set_src(art, (const void **)crystal_imgs, 16);
-    lv_animimg_set_duration(art, CONFIG_NICE_OLED_GEM_ANIMATION_MS);
-    lv_animimg_set_repeat_count(art, LV_ANIM_REPEAT_INFINITE);
-    lv_animimg_start(art);
-
 #elif IS_ENABLED(CONFIG_NICE_OLED_POKEMON_ANIMATION)
     /* If we have the Pokémon animation enabled */
-    art = lv_animimg_create(widget->obj);
+    delta_anim_init(&player, &pokemon_anim, frame_buf, LVGL_BACKGROUND, LVGL_FOREGROUND);
+    art = delta_anim_create(widget->obj, &player, CONFIG_NICE_OLED_POKEMON_ANIMATION_MS);
     lv_obj_center(art);
 
-    lv_animimg_set_src(art, (const void **)pokemon_imgs, 20);
-    lv_animimg_set_duration(art, CONFIG_NICE_OLED_POKEMON_ANIMATION_MS);
-    lv_animimg_set_repeat_count(art, LV_ANIM_REPEAT_INFINITE);
-    lv_animimg_start(art);
-
 #else
     /* If we do not want animation (for example, config nice oled gem animation
      * = n) Then we load a fixed image (you can choose it or make it random).
-     * IMPORTANT: Crystal IMGS must be defined in some #if previous or
-     * elsewhere. If not, you should create your arrangement with fixed images.
+     * IMPORTANT: crystal_anim must be built in (assets/crystal_anim.c). If
+     * not, you should create your arrangement with fixed images.
      */
 
     /* Random image example: */
-    int length = sizeof(crystal_imgs) / sizeof(crystal_imgs[0]);
+    int length = crystal_anim.frame_count;
     srand(k_uptime_get_32());
     int random_index = rand() % length;
 
+    delta_anim_init(&player, &crystal_anim, frame_buf, LVGL_BACKGROUND, LVGL_FOREGROUND);
+    delta_anim_seek(&player, random_index);
+
     art = lv_img_create(widget->obj);
-    lv_img_set_src(art, crystal_imgs[random_index]);
+    lv_img_set_src(art, &player.img);
 #endif
 
 #if IS_ENABLED(CONFIG_NICE_OLED_VIM)
@@ -1,71 +1,69 @@
 #include "battery.h"
+#include "delta_anim.h"
 #include "../assets/custom_fonts.h"
 #include <zephyr/kernel.h>
 
 LV_IMG_DECLARE(bolt);
 
 #if IS_ENABLED(CONFIG_NICE_OLED_GEM_ANIMATION_SMART_BATTERY)
-// Work at how it is expected, but after disconnecting the keyboard 3 times it is fried
 // CONFIG_NICE_OLED_GEM_ANIMATION
-LV_IMG_DECLARE(crystal_01);
-LV_IMG_DECLARE(crystal_02);
-LV_IMG_DECLARE(crystal_03);
-LV_IMG_DECLARE(crystal_04);
-LV_IMG_DECLARE(crystal_05);
-LV_IMG_DECLARE(crystal_06);
-LV_IMG_DECLARE(crystal_07);
-LV_IMG_DECLARE(crystal_08);
-LV_IMG_DECLARE(crystal_09);
-LV_IMG_DECLARE(crystal_10);
-LV_IMG_DECLARE(crystal_11);
-LV_IMG_DECLARE(crystal_12);
-LV_IMG_DECLARE(crystal_13);
-LV_IMG_DECLARE(crystal_14);
-LV_IMG_DECLARE(crystal_15);
-LV_IMG_DECLARE(crystal_16);
+extern const struct delta_anim crystal_anim;
 
+// Index of the crystal_anim frame shown while it is off, from 0 to 15. This
+// used to be an image, such as &crystal_01; frame n is crystal_<n + 1>.
 #ifndef SET_ANIMATION_SMART_BATTERY_OFF
-#define SET_ANIMATION_SMART_BATTERY_OFF &crystal_01
+#define SET_ANIMATION_SMART_BATTERY_OFF 0
 #endif
 
-const lv_img_dsc_t *crystal_imgs_test[] = {
-    &crystal_01, &crystal_02, &crystal_03, &crystal_04, &crystal_05, &crystal_06,
-    &crystal_07, &crystal_08, &crystal_09, &crystal_10, &crystal_11, &crystal_12,
-    &crystal_13, &crystal_14, &crystal_15, &crystal_16,
+enum smart_battery_state {
+    SMART_BATTERY_NONE,
+    SMART_BATTERY_CHARGING,
+    SMART_BATTERY_DISCHARGING,
 };
 
-static lv_obj_t *art = NULL;
-static lv_obj_t *art2 = NULL;
+/*
+ * One image and player for the lifetime of the screen. Redraws only move
+ * between the states on a change of state->charging, so nothing is
+ * allocated while the charging state stays the same.
+ */
+static enum smart_battery_state smart_battery_state;
+static struct delta_anim_player player;
+static uint8_t frame_buf[DELTA_ANIM_BUF_SIZE(69, 68)];
+
+static void animation_smart_battery_deleted(lv_event_t *event) {
+    smart_battery_state = SMART_BATTERY_NONE;
+}
 
-static void animation_smart_battery_on(lv_obj_t *canvas) {
-    if (art2) {
-        lv_obj_del(art2);
-        art2 = NULL;
-    }
-    art = lv_animimg_create(canvas);
-    lv_obj_center(art);
+static void animation_smart_battery_create(lv_obj_t *canvas) {
+    delta_anim_init(&player, &crystal_anim, frame_buf, LVGL_BACKGROUND, LVGL_FOREGROUND);
 
-    lv_animimg_set_src(art, (const void **)crystal_imgs_test, 16);
-    lv_animimg_set_duration(art, CONFIG_NICE_OLED_GEM_ANIMATION_MS);
-    lv_animimg_set_repeat_count(art, LV_ANIM_REPEAT_INFINITE);
-    lv_animimg_start(art);
+    lv_obj_t *art =
+        delta_anim_create(lv_obj_get_parent(canvas), &player, CONFIG_NICE_OLED_GEM_ANIMATION_MS);
     lv_obj_align(art, LV_ALIGN_TOP_LEFT, 18, -18);
+    lv_obj_add_event_cb(art, animation_smart_battery_deleted, LV_EVENT_DELETE, NULL);
 }
-static void animation_smart_battery_off(lv_obj_t *canvas) {
 
-    if (art) {
-        lv_obj_del(art);
-        art = NULL;
+static void animation_smart_battery_update(lv_obj_t *canvas, bool charging) {
+    enum smart_battery_state next =
+        charging ? SMART_BATTERY_CHARGING : SMART_BATTERY_DISCHARGING;
+
+    if (next == smart_battery_state) {
+        return;
+    }
+
+    if (smart_battery_state == SMART_BATTERY_NONE) {
+        animation_smart_battery_create(canvas);
     }
-    /*
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-    lv_canvas_draw_img(canvas, 18, -18, SET_ANIMATION_SMART_BATTERY_OFF, &img_dsc);
-    */
 
-    art2 = lv_img_create(canvas);
-    lv_img_set_src(art2, SET_ANIMATION_SMART_BATTERY_OFF);
-    lv_obj_align(art2, LV_ALIGN_TOP_LEFT, 18, -18);
+    if (next == SMART_BATTERY_CHARGING) {
+        delta_anim_set_running(&player, true);
+    } else {
+        delta_anim_set_running(&player, false);
+        delta_anim_seek(&player, SET_ANIMATION_SMART_BATTERY_OFF);
+        lv_obj_invalidate(player.obj);
+    }
+
+    smart_battery_state = next;
 }
 #endif
 
@@ -79,7 +77,7 @@ static void draw_level(lv_obj_t *canvas, const struct status_state *state) {
     sprintf(text, "%i%%", state->battery);
     // sprintf(text, "%i%%", state->battery);
     // x, y, width, dsc, text
-    lv_canvas_draw_text(canvas, 0, 50, 42, &label_right_dsc, text);
+    canvas_draw_text(canvas, 0, 50, 42, &label_right_dsc, text);
     // lv_canvas_draw_text(canvas, -6, 50, 42, &label_right_dsc, text);
 }
 
@@ -94,9 +92,9 @@ static void draw_charging_level(lv_obj_t *canvas, const struct status_state *sta
 
     sprintf(text, "%i", state->battery);
     // sprintf(text, "%i%%", state->battery);
-    lv_canvas_draw_text(canvas, 0, 50, 35, &label_right_dsc, text);
+    canvas_draw_text(canvas, 0, 50, 35, &label_right_dsc, text);
     // lv_canvas_draw_text(canvas, 1, 50, 35, &label_right_dsc, text);
-    lv_canvas_draw_img(canvas, 25, 50, &bolt, &img_dsc);
+    canvas_draw_img(canvas, 25, 50, &bolt, &img_dsc);
     // lv_canvas_draw_img(canvas, 0, 50, &bolt, &img_dsc);
 }
 
@@ -110,14 +108,11 @@ void draw_battery_status(lv_obj_t *canvas, const struct status_state *state) {
 
     if (state->charging) {
         draw_charging_level(canvas, state);
-#if IS_ENABLED(CONFIG_NICE_OLED_GEM_ANIMATION_SMART_BATTERY)
-        animation_smart_battery_on(canvas);
-#endif
-
     } else {
         draw_level(canvas, state);
+    }
+
 #if IS_ENABLED(CONFIG_NICE_OLED_GEM_ANIMATION_SMART_BATTERY)
-        animation_smart_battery_off(canvas);
+    animation_smart_battery_update(canvas, state->charging);
 #endif
-    }
 }
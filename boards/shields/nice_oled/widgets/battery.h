@@ -9,4 +9,7 @@ struct battery_status_state {
     bool usb_present;
 #endif
 };
+/* Portrait canvas area owned by draw_battery_status() */
+#define BATTERY_STATUS_AREA {.x1 = 0, .y1 = 48, .x2 = CANVAS_WIDTH - 1, .y2 = 63}
+
 void draw_battery_status(lv_obj_t *canvas, const struct status_state *state);
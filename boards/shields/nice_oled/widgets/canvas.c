@@ -0,0 +1,590 @@
+#include "canvas.h"
+#include "render_stats.h"
+#include "rle_img.h"
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#define PALETTE_SIZE (2 * sizeof(lv_color32_t))
+
+/*
+ * The canvas buffer is horizontal (CANVAS_HEIGHT x CANVAS_WIDTH) while the
+ * widgets draw in portrait, so a portrait point (x, y) lands on column
+ * w - 1 - y and row x of the canvas. This is the same mapping the previous
+ * lv_canvas_transform() rotation by 900 produced.
+ *
+ * Pixels are stored one bit each, MSB first, in rows padded to whole bytes
+ * after the two palette entries, as LVGL expects for LV_IMG_CF_INDEXED_1BIT.
+ */
+static inline uint8_t *canvas_row(const lv_img_dsc_t *img, lv_coord_t row) {
+    return (uint8_t *)img->data + PALETTE_SIZE + row * ((img->header.w + 7) >> 3);
+}
+
+static inline void set_px(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y, uint8_t index) {
+    lv_coord_t w = img->header.w;
+
+    if (x < 0 || x >= img->header.h || y < 0 || y >= w) {
+        return;
+    }
+
+    lv_coord_t col = w - 1 - y;
+    uint8_t *byte = &canvas_row(img, x)[col >> 3];
+    uint8_t mask = 0x80 >> (col & 7);
+
+    *byte = index ? (*byte | mask) : (*byte & ~mask);
+}
+
+// Set or clear bits x1..x2 of one row, a byte at a time
+static void fill_row(uint8_t *row, lv_coord_t x1, lv_coord_t x2, uint8_t index) {
+    while (x1 <= x2) {
+        lv_coord_t end = MIN(x2, x1 | 7);
+        uint8_t mask = (0xff >> (x1 & 7)) & (0xff << (7 - (end & 7)));
+        uint8_t *byte = &row[x1 >> 3];
+
+        *byte = index ? (*byte | mask) : (*byte & ~mask);
+        x1 = end + 1;
+    }
+}
+
+// Copy bits x1..x2 of one row from src, whole bytes at a time in between
+static void copy_row(uint8_t *row, const uint8_t *src, lv_coord_t x1, lv_coord_t x2) {
+    lv_coord_t first = x1 >> 3;
+    lv_coord_t last = x2 >> 3;
+    uint8_t head = 0xff >> (x1 & 7);
+    uint8_t tail = 0xff << (7 - (x2 & 7));
+
+    if (first == last) {
+        head &= tail;
+    } else {
+        memcpy(&row[first + 1], &src[first + 1], last - first - 1);
+        row[last] = (row[last] & ~tail) | (src[last] & tail);
+    }
+    row[first] = (row[first] & ~head) | (src[first] & head);
+}
+
+static inline bool is_bright(lv_color_t color) { return lv_color_brightness(color) > 127; }
+
+// Palette index of the canvas color closest to color
+static uint8_t color_index(const lv_img_dsc_t *img, lv_color_t color) {
+    const lv_color32_t *palette = (const lv_color32_t *)img->data;
+    lv_color_t fg = lv_color_make(palette[1].ch.red, palette[1].ch.green, palette[1].ch.blue);
+
+    return is_bright(color) == is_bright(fg);
+}
+
+// The canvas whose pages are flushed by canvas_flush_pages(), if any
+static struct {
+    lv_obj_t *canvas;
+    uint8_t *shadow;
+    lv_coord_t rows;
+    bool lines;
+    lv_area_t pending;
+    bool dirty;
+} pages;
+
+static void invalidate(lv_obj_t *canvas, lv_coord_t x1, lv_coord_t y1, lv_coord_t x2,
+                       lv_coord_t y2) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    lv_area_t area = {
+        .x1 = img->header.w - 1 - y2,
+        .y1 = x1,
+        .x2 = img->header.w - 1 - y1,
+        .y2 = x2,
+    };
+    lv_area_t bounds = {0, 0, img->header.w - 1, img->header.h - 1};
+    lv_area_t coords;
+
+    if (!_lv_area_intersect(&area, &area, &bounds)) {
+        return;
+    }
+    render_stats_add_area(&area);
+
+    if (canvas == pages.canvas) {
+        if (pages.dirty) {
+            _lv_area_join(&pages.pending, &pages.pending, &area);
+        } else {
+            pages.pending = area;
+            pages.dirty = true;
+        }
+        return;
+    }
+
+    lv_obj_get_coords(canvas, &coords);
+    lv_area_move(&area, coords.x1, coords.y1);
+    lv_obj_invalidate_area(canvas, &area);
+}
+
+void canvas_draw_rect(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                      const lv_draw_rect_dsc_t *dsc) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+
+    if (dsc->bg_opa <= LV_OPA_MIN) {
+        return;
+    }
+
+    // Portrait columns become canvas rows, portrait rows become the span
+    lv_coord_t row1 = MAX(x, 0);
+    lv_coord_t row2 = MIN(x + w - 1, img->header.h - 1);
+    lv_coord_t col1 = MAX(img->header.w - y - h, 0);
+    lv_coord_t col2 = MIN(img->header.w - 1 - y, img->header.w - 1);
+    uint8_t index = color_index(img, dsc->bg_color);
+
+    if (row1 > row2 || col1 > col2) {
+        return;
+    }
+
+    for (lv_coord_t row = row1; row <= row2; row++) {
+        fill_row(canvas_row(img, row), col1, col2, index);
+    }
+
+    invalidate(canvas, x, y, x + w - 1, y + h - 1);
+}
+
+static void draw_line_segment(const lv_img_dsc_t *img, lv_point_t p1, lv_point_t p2,
+                              lv_coord_t lo, lv_coord_t hi, uint8_t index) {
+    lv_coord_t dx = LV_ABS(p2.x - p1.x);
+    lv_coord_t dy = -LV_ABS(p2.y - p1.y);
+    lv_coord_t sx = p1.x < p2.x ? 1 : -1;
+    lv_coord_t sy = p1.y < p2.y ? 1 : -1;
+    lv_coord_t err = dx + dy;
+    bool steep = -dy > dx;
+
+    for (;;) {
+        // Thick lines are widened across their main direction, like LVGL does
+        for (lv_coord_t i = lo; i <= hi; i++) {
+            if (steep) {
+                set_px(img, p1.x + i, p1.y, index);
+            } else {
+                set_px(img, p1.x, p1.y + i, index);
+            }
+        }
+
+        if (p1.x == p2.x && p1.y == p2.y) {
+            break;
+        }
+
+        lv_coord_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            p1.x += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            p1.y += sy;
+        }
+    }
+}
+
+void canvas_draw_line(lv_obj_t *canvas, const lv_point_t points[], uint32_t point_cnt,
+                      const lv_draw_line_dsc_t *dsc) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+
+    if (point_cnt < 2) {
+        return;
+    }
+
+    // Same rounding as LVGL for even widths: the extra pixel goes above/left
+    lv_coord_t w = dsc->width - 1;
+    lv_coord_t hi = w >> 1;
+    lv_coord_t lo = -(hi + (w & 1));
+
+    uint8_t index = color_index(img, dsc->color);
+    lv_area_t bounds = {points[0].x, points[0].y, points[0].x, points[0].y};
+    for (uint32_t i = 0; i < point_cnt - 1; i++) {
+        draw_line_segment(img, points[i], points[i + 1], lo, hi, index);
+
+        bounds.x1 = MIN(bounds.x1, points[i + 1].x);
+        bounds.y1 = MIN(bounds.y1, points[i + 1].y);
+        bounds.x2 = MAX(bounds.x2, points[i + 1].x);
+        bounds.y2 = MAX(bounds.y2, points[i + 1].y);
+    }
+
+    invalidate(canvas, bounds.x1 + lo, bounds.y1 + lo, bounds.x2 + hi, bounds.y2 + hi);
+}
+
+/*
+ * 1 bpp sources are rotated 8x8 pixels at a time: eight source rows are
+ * loaded bottom row first, and transposing that bit matrix yields eight
+ * canvas row bytes in one go. Rotating by 90 degrees is a transpose plus a
+ * flip, and loading the rows reversed is the flip.
+ */
+struct blit_src {
+    const uint8_t *data;
+    uint32_t stride; // bits from one row to the next
+    uint32_t size;   // bits in data
+    lv_coord_t w;
+    lv_coord_t h;
+};
+
+// Transpose an 8x8 bit matrix, MSB first (Hacker's Delight, transpose8)
+static void transpose8(uint8_t m[8]) {
+    uint32_t x = ((uint32_t)m[0] << 24) | (m[1] << 16) | (m[2] << 8) | m[3];
+    uint32_t y = ((uint32_t)m[4] << 24) | (m[5] << 16) | (m[6] << 8) | m[7];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00aa00aa;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00aa00aa;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000cccc;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000cccc;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xf0f0f0f0) | ((y >> 4) & 0x0f0f0f0f);
+    y = ((x << 4) & 0xf0f0f0f0) | (y & 0x0f0f0f0f);
+    x = t;
+
+    m[0] = x >> 24;
+    m[1] = x >> 16;
+    m[2] = x >> 8;
+    m[3] = x;
+    m[4] = y >> 24;
+    m[5] = y >> 16;
+    m[6] = y >> 8;
+    m[7] = y;
+}
+
+// Eight source bits starting at any bit offset, MSB first
+static inline uint8_t load_bits(const struct blit_src *src, uint32_t bit) {
+    uint32_t byte = bit >> 3;
+    uint8_t shift = bit & 7;
+    uint8_t bits = src->data[byte] << shift;
+
+    if (shift && (byte + 1) << 3 < src->size) {
+        bits |= src->data[byte + 1] >> (8 - shift);
+    }
+    return bits;
+}
+
+// Write the mask bits of value to canvas columns x..x+7 of one row
+static void write_bits(uint8_t *row, lv_coord_t w, lv_coord_t x, uint8_t value, uint8_t mask) {
+    if (x <= -8 || x >= w) {
+        return;
+    }
+    if (x < 0) {
+        value <<= -x;
+        mask <<= -x;
+        x = 0;
+    }
+    if (w - x < 8) {
+        mask &= 0xff << (8 - (w - x));
+    }
+
+    uint8_t shift = x & 7;
+    uint8_t *byte = &row[x >> 3];
+    uint16_t v = (uint16_t)value << (8 - shift);
+    uint16_t m = (uint16_t)mask << (8 - shift);
+
+    byte[0] = (byte[0] & ~(m >> 8)) | ((v & m) >> 8);
+    if ((uint8_t)m) {
+        byte[1] = (byte[1] & ~(uint8_t)m) | (v & m & 0xff);
+    }
+}
+
+// Draw src with its top left corner at portrait (x, y). Source pixels with
+// value i are set to indexes[i], or left alone if opaque[i] is false.
+static void blit_rotated(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y,
+                         const struct blit_src *src, const uint8_t indexes[2],
+                         const bool opaque[2]) {
+    for (lv_coord_t r0 = 0; r0 < src->h; r0 += 8) {
+        // Block bit i is source row r0 + 7 - i, on canvas column col + i
+        lv_coord_t col = img->header.w - 8 - y - r0;
+        uint8_t valid = 0xff >> MAX(r0 + 8 - src->h, 0);
+
+        if (col <= -8 || col >= img->header.w) {
+            continue;
+        }
+
+        for (lv_coord_t c0 = 0; c0 < src->w; c0 += 8) {
+            uint8_t block[8];
+
+            for (int i = 0; i < 8; i++) {
+                lv_coord_t row = r0 + 7 - i;
+                block[i] = row < src->h ? load_bits(src, row * src->stride + c0) : 0;
+            }
+            transpose8(block);
+
+            // Block byte j is source column c0 + j, which is canvas row x + c0 + j
+            for (int j = 0; j < 8 && c0 + j < src->w; j++) {
+                lv_coord_t row = x + c0 + j;
+                uint8_t bits = block[j];
+
+                if (row < 0 || row >= img->header.h) {
+                    continue;
+                }
+
+                uint8_t value = (indexes[1] ? bits : 0) | (indexes[0] ? ~bits : 0);
+                uint8_t mask = ((opaque[1] ? bits : 0) | (opaque[0] ? ~bits : 0)) & valid;
+                write_bits(canvas_row(img, row), img->header.w, col, value, mask);
+            }
+        }
+    }
+}
+
+void canvas_draw_img(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, const void *src,
+                     const lv_draw_img_dsc_t *dsc) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    LV_UNUSED(dsc);
+
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) {
+        LV_LOG_WARN("only variable images are supported");
+        return;
+    }
+
+    const lv_img_dsc_t *src_img = src;
+    if (src_img->header.cf != LV_IMG_CF_INDEXED_1BIT && src_img->header.cf != RLE_IMG_CF) {
+        LV_LOG_WARN("only LV_IMG_CF_INDEXED_1BIT and RLE_IMG_CF images are supported");
+        return;
+    }
+
+    // Same layout as the canvas: palette first, then rows padded to bytes
+    const lv_color32_t *palette = (const lv_color32_t *)src_img->data;
+    struct blit_src bits = {
+        .data = src_img->data + PALETTE_SIZE,
+        .stride = ((src_img->header.w + 7) >> 3) << 3,
+        .w = src_img->header.w,
+        .h = src_img->header.h,
+    };
+    bits.size = bits.stride * bits.h;
+
+    // Encoded images are expanded into a scratch buffer first
+    uint8_t *decoded = NULL;
+    if (src_img->header.cf == RLE_IMG_CF) {
+        struct rle_img_reader reader;
+
+        decoded = lv_mem_buf_get(bits.size >> 3);
+        if (decoded == NULL) {
+            return;
+        }
+        rle_img_reader_init(&reader, src_img);
+        rle_img_read(&reader, decoded, bits.size >> 3);
+        bits.data = decoded;
+    }
+
+    uint8_t indexes[2];
+    bool opaque[2];
+    for (int i = 0; i < 2; i++) {
+        indexes[i] = color_index(
+            img, lv_color_make(palette[i].ch.red, palette[i].ch.green, palette[i].ch.blue));
+        opaque[i] = palette[i].ch.alpha > LV_OPA_50;
+    }
+
+    blit_rotated(img, x, y, &bits, indexes, opaque);
+
+    if (decoded) {
+        lv_mem_buf_release(decoded);
+    }
+
+    invalidate(canvas, x, y, x + src_img->header.w - 1, y + src_img->header.h - 1);
+}
+
+static void draw_glyph(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y,
+                       const lv_font_glyph_dsc_t *g, const uint8_t *bitmap, uint8_t index) {
+    // Glyph bitmaps are packed without row padding, which the 1 bpp blit
+    // handles through its bit stride
+    if (g->bpp == 1) {
+        const struct blit_src bits = {
+            .data = bitmap,
+            .stride = g->box_w,
+            .size = g->box_w * g->box_h,
+            .w = g->box_w,
+            .h = g->box_h,
+        };
+        const uint8_t indexes[2] = {0, index};
+        const bool opaque[2] = {false, true};
+
+        blit_rotated(img, x, y, &bits, indexes, opaque);
+        return;
+    }
+
+    // Otherwise pixels at or above half intensity are set
+    uint8_t mask = (1 << g->bpp) - 1;
+    uint8_t half = 1 << (g->bpp - 1);
+
+    for (lv_coord_t row = 0; row < g->box_h; row++) {
+        for (lv_coord_t col = 0; col < g->box_w; col++) {
+            uint32_t bit = (row * g->box_w + col) * g->bpp;
+            uint8_t value = (bitmap[bit >> 3] >> (8 - g->bpp - (bit & 7))) & mask;
+
+            if (value >= half) {
+                set_px(img, x + col, y + row, index);
+            }
+        }
+    }
+}
+
+void canvas_draw_text(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t max_w,
+                      const lv_draw_label_dsc_t *dsc, const char *txt) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    const lv_font_t *font = dsc->font;
+    uint8_t index = color_index(img, dsc->color);
+
+    if (dsc->align == LV_TEXT_ALIGN_CENTER || dsc->align == LV_TEXT_ALIGN_RIGHT) {
+        lv_coord_t line_w =
+            lv_txt_get_width(txt, strlen(txt), font, dsc->letter_space, dsc->flag);
+
+        x += dsc->align == LV_TEXT_ALIGN_CENTER ? (max_w - line_w) / 2 : max_w - line_w;
+    }
+
+    lv_coord_t pos_x = x;
+    uint32_t i = 0;
+    uint32_t letter = _lv_txt_encoded_next(txt, &i);
+
+    while (letter != 0) {
+        uint32_t letter_next = _lv_txt_encoded_next(&txt[i], NULL);
+        lv_font_glyph_dsc_t g;
+
+        if (lv_font_get_glyph_dsc(font, &g, letter, letter_next)) {
+            const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, letter);
+
+            if (bitmap != NULL && g.bpp > 0) {
+                // Same baseline placement as lv_draw_letter()
+                lv_coord_t gy = y + (font->line_height - font->base_line) - g.box_h - g.ofs_y;
+                draw_glyph(img, pos_x + g.ofs_x, gy, &g, bitmap, index);
+            }
+            pos_x += g.adv_w + dsc->letter_space;
+        }
+
+        letter = _lv_txt_encoded_next(txt, &i);
+    }
+
+    invalidate(canvas, x, y, pos_x, y + font->line_height - 1);
+}
+
+void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color, const lv_font_t *font,
+                    lv_text_align_t align) {
+    lv_draw_label_dsc_init(label_dsc);
+    label_dsc->color = color;
+    label_dsc->font = font;
+    label_dsc->align = align;
+}
+
+void init_rect_dsc(lv_draw_rect_dsc_t *rect_dsc, lv_color_t bg_color) {
+    lv_draw_rect_dsc_init(rect_dsc);
+    rect_dsc->bg_color = bg_color;
+}
+
+void init_line_dsc(lv_draw_line_dsc_t *line_dsc, lv_color_t color, uint8_t width) {
+    lv_draw_line_dsc_init(line_dsc);
+    line_dsc->color = color;
+    line_dsc->width = width;
+}
+
+void canvas_save(lv_obj_t *canvas, uint8_t *buf) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+
+    memcpy(buf, img->data, canvas_row(img, img->header.h) - img->data);
+}
+
+void canvas_restore_area(lv_obj_t *canvas, const uint8_t *buf, lv_coord_t x, lv_coord_t y,
+                         lv_coord_t w, lv_coord_t h) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+
+    // Same rows and span as canvas_draw_rect()
+    lv_coord_t row1 = MAX(x, 0);
+    lv_coord_t row2 = MIN(x + w - 1, img->header.h - 1);
+    lv_coord_t col1 = MAX(img->header.w - y - h, 0);
+    lv_coord_t col2 = MIN(img->header.w - 1 - y, img->header.w - 1);
+
+    if (row1 > row2 || col1 > col2) {
+        return;
+    }
+
+    for (lv_coord_t row = row1; row <= row2; row++) {
+        uint8_t *dst = canvas_row(img, row);
+
+        copy_row(dst, buf + (dst - img->data), col1, col2);
+    }
+
+    invalidate(canvas, x, y, x + w - 1, y + h - 1);
+}
+
+static void track(lv_obj_t *canvas, uint8_t *shadow, lv_coord_t rows, bool lines) {
+    pages.canvas = canvas;
+    pages.shadow = shadow;
+    pages.rows = rows;
+    pages.lines = lines;
+    pages.dirty = false;
+
+    // Everything is flushed once, from then on only what changes
+    canvas_save(canvas, shadow);
+    lv_obj_invalidate(canvas);
+}
+
+void canvas_track_pages(lv_obj_t *canvas, uint8_t *shadow) {
+    track(canvas, shadow, CANVAS_PAGE_ROWS, false);
+}
+
+void canvas_track_lines(lv_obj_t *canvas, uint8_t *shadow) { track(canvas, shadow, 1, true); }
+
+static void flush_area(lv_obj_t *canvas, lv_area_t area) {
+    lv_area_t coords;
+
+    render_stats_add_flush(&area);
+    lv_obj_get_coords(canvas, &coords);
+    lv_area_move(&area, coords.x1, coords.y1);
+    lv_obj_invalidate_area(canvas, &area);
+}
+
+void canvas_flush_pages(lv_obj_t *canvas) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    const lv_area_t *pending = &pages.pending;
+    lv_coord_t byte1 = pending->x1 >> 3;
+    lv_coord_t byte2 = pending->x2 >> 3;
+    lv_coord_t rows = pages.rows;
+    lv_area_t run;
+    bool running = false;
+
+    if (canvas != pages.canvas || !pages.dirty) {
+        return;
+    }
+    pages.dirty = false;
+
+    for (lv_coord_t page = pending->y1 / rows; page <= pending->y2 / rows; page++) {
+        lv_coord_t row1 = MAX(page * rows, pending->y1);
+        lv_coord_t row2 = MIN(page * rows + rows - 1, pending->y2);
+        lv_coord_t first = byte2 + 1;
+        lv_coord_t last = byte1 - 1;
+
+        // Bytes of the page that differ from the shadow, then bring it up to date
+        for (lv_coord_t row = row1; row <= row2; row++) {
+            uint8_t *src = canvas_row(img, row);
+            uint8_t *dst = pages.shadow + (src - img->data);
+
+            for (lv_coord_t i = byte1; i <= byte2; i++) {
+                if (src[i] != dst[i]) {
+                    first = MIN(first, i);
+                    last = MAX(last, i);
+                }
+            }
+            memcpy(&dst[byte1], &src[byte1], byte2 - byte1 + 1);
+        }
+
+        if (first > last) {
+            continue;
+        }
+
+        lv_area_t area = {
+            .x1 = pages.lines ? 0 : first << 3,
+            .y1 = page * rows,
+            .x2 = pages.lines ? img->header.w - 1 : MIN((last << 3) + 7, img->header.w - 1),
+            .y2 = MIN(page * rows + rows - 1, img->header.h - 1),
+        };
+
+        // Whole lines that follow each other go out together
+        if (running && pages.lines && run.y2 + 1 == area.y1) {
+            run.y2 = area.y2;
+            continue;
+        }
+        if (running) {
+            flush_area(canvas, run);
+        }
+        run = area;
+        running = true;
+    }
+
+    if (running) {
+        flush_area(canvas, run);
+    }
+}
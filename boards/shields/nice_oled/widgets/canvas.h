@@ -0,0 +1,65 @@
+#pragma once
+
+#include <lvgl.h>
+
+/*
+ * Drawing primitives for the horizontal status canvas.
+ *
+ * They take the same portrait coordinates and descriptors as the
+ * lv_canvas_draw_*() functions, and apply the 90 degree rotation while each
+ * primitive is drawn, so the canvas is always in panel orientation and no
+ * rotation pass is needed. Only the area that was drawn is invalidated.
+ *
+ * The canvas must use a packed LV_IMG_CF_INDEXED_1BIT buffer with the
+ * background in palette index 0 and the foreground in index 1, which LVGL
+ * cannot draw into itself. CANVAS_BUF_SIZE() gives the buffer size.
+ * canvas_draw_img() takes LV_IMG_CF_INDEXED_1BIT and RLE_IMG_CF images.
+ */
+
+#define CANVAS_BUF_SIZE(w, h) LV_CANVAS_BUF_SIZE_INDEXED_1BIT(w, h)
+
+#define LVGL_BACKGROUND                                                                            \
+    IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_black() : lv_color_white()
+#define LVGL_FOREGROUND                                                                            \
+    IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_white() : lv_color_black()
+
+// Descriptors set up for the primitives below, shared by both shields
+void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color, const lv_font_t *font,
+                    lv_text_align_t align);
+void init_rect_dsc(lv_draw_rect_dsc_t *rect_dsc, lv_color_t bg_color);
+void init_line_dsc(lv_draw_line_dsc_t *line_dsc, lv_color_t color, uint8_t width);
+
+void canvas_draw_rect(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
+                      const lv_draw_rect_dsc_t *dsc);
+void canvas_draw_line(lv_obj_t *canvas, const lv_point_t points[], uint32_t point_cnt,
+                      const lv_draw_line_dsc_t *dsc);
+void canvas_draw_img(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, const void *src,
+                     const lv_draw_img_dsc_t *dsc);
+void canvas_draw_text(lv_obj_t *canvas, lv_coord_t x, lv_coord_t y, lv_coord_t max_w,
+                      const lv_draw_label_dsc_t *dsc, const char *txt);
+
+/*
+ * Flush of only what changed. Once a canvas is tracked the primitives only
+ * record what they touched, and canvas_flush_pages() compares that with
+ * shadow, the copy of what was last flushed, and invalidates what differs:
+ *
+ * - canvas_track_pages() for vertically tiled panels like the SSD1306,
+ *   whose pages are CANVAS_PAGE_ROWS canvas rows: the changed columns of
+ *   each page.
+ * - canvas_track_lines() for line-addressed panels like the Sharp LS0xx,
+ *   which rewrite whole canvas rows: each run of changed rows as a single
+ *   area, so it is sent in one multi-line transfer.
+ *
+ * Redrawing an area with the same pixels then costs no bus transfer.
+ */
+#define CANVAS_PAGE_ROWS 8
+
+void canvas_track_pages(lv_obj_t *canvas, uint8_t *shadow);
+void canvas_track_lines(lv_obj_t *canvas, uint8_t *shadow);
+void canvas_flush_pages(lv_obj_t *canvas);
+
+// Copy the whole canvas into buf, a CANVAS_BUF_SIZE() buffer of the same size
+void canvas_save(lv_obj_t *canvas, uint8_t *buf);
+// Copy a portrait area back from a buffer filled by canvas_save()
+void canvas_restore_area(lv_obj_t *canvas, const uint8_t *buf, lv_coord_t x, lv_coord_t y,
+                         lv_coord_t w, lv_coord_t h);
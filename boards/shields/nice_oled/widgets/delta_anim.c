@@ -0,0 +1,161 @@
+#include "delta_anim.h"
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#define PALETTE_SIZE (2 * sizeof(lv_color32_t))
+
+// XOR one delta into bitmap, returning the stream offset that follows it
+static uint32_t apply_delta(uint8_t *bitmap, uint32_t size, const uint8_t *data, uint32_t pos) {
+    uint32_t i = 0;
+
+    while (i < size) {
+        uint8_t ctrl = data[pos++];
+
+        if (ctrl & 0x80) {
+            // Literal: the bytes to XOR follow
+            for (uint32_t end = i + (ctrl & 0x7f) + 1; i < end; i++) {
+                bitmap[i] ^= data[pos++];
+            }
+        } else if (ctrl & 0x40) {
+            // Repeat: one byte to XOR into a run
+            uint8_t value = data[pos++];
+
+            for (uint32_t end = i + (ctrl & 0x3f) + 1; i < end; i++) {
+                bitmap[i] ^= value;
+            }
+        } else {
+            // Skip: unchanged bytes
+            i += ctrl + 1;
+        }
+    }
+
+    return pos;
+}
+
+static inline uint32_t frame_size(const struct delta_anim *anim) {
+    return anim->h * ((anim->w + 7) >> 3);
+}
+
+static void restart(struct delta_anim_player *player) {
+    uint8_t *bitmap = (uint8_t *)player->img.data + PALETTE_SIZE;
+    uint32_t size = frame_size(player->anim);
+
+    memset(bitmap, 0, size);
+    apply_delta(bitmap, size, player->anim->data, 0);
+    player->pos = player->anim->loop;
+    player->frame = 0;
+}
+
+void delta_anim_init(struct delta_anim_player *player, const struct delta_anim *anim, uint8_t *buf,
+                     lv_color_t bg, lv_color_t fg) {
+    lv_color32_t *palette = (lv_color32_t *)buf;
+
+    palette[0].full = lv_color_to32(bg);
+    palette[1].full = lv_color_to32(fg);
+
+    player->anim = anim;
+    player->img = (lv_img_dsc_t){
+        .header.cf = LV_IMG_CF_INDEXED_1BIT,
+        .header.w = anim->w,
+        .header.h = anim->h,
+        .data_size = PALETTE_SIZE + frame_size(anim),
+        .data = buf,
+    };
+    restart(player);
+}
+
+void delta_anim_next(struct delta_anim_player *player) {
+    uint8_t *bitmap = (uint8_t *)player->img.data + PALETTE_SIZE;
+
+    player->pos = apply_delta(bitmap, frame_size(player->anim), player->anim->data, player->pos);
+    player->frame++;
+
+    // The last delta leads back to frame 0
+    if (player->frame == player->anim->frame_count) {
+        player->pos = player->anim->loop;
+        player->frame = 0;
+    }
+}
+
+void delta_anim_seek(struct delta_anim_player *player, uint16_t frame) {
+    if (frame < player->frame) {
+        restart(player);
+    }
+    while (player->frame < frame) {
+        delta_anim_next(player);
+    }
+}
+
+static void timer_cb(lv_timer_t *timer) {
+    struct delta_anim_player *player = timer->user_data;
+
+    delta_anim_next(player);
+    lv_obj_invalidate(player->obj);
+}
+
+// Animations of delta_anim_create(), for delta_anim_set_paused()
+static sys_slist_t players = SYS_SLIST_STATIC_INIT(&players);
+static bool paused;
+
+// Run the frame timer at the rate the governor allows, unless stopped
+static void update_timer(struct delta_anim_player *player) {
+    uint32_t period = player->running && !paused ? anim_governor_period(player->period) : 0;
+
+    if (period == 0) {
+        lv_timer_pause(player->timer);
+        return;
+    }
+
+    lv_timer_set_period(player->timer, period);
+    lv_timer_resume(player->timer);
+}
+
+static void governor_changed(struct anim_governor_listener *listener) {
+    update_timer(CONTAINER_OF(listener, struct delta_anim_player, governor));
+}
+
+static void delete_cb(lv_event_t *event) {
+    struct delta_anim_player *player = lv_event_get_user_data(event);
+
+    anim_governor_remove(&player->governor);
+    sys_slist_find_and_remove(&players, &player->node);
+    lv_timer_del(player->timer);
+    player->timer = NULL;
+    player->obj = NULL;
+}
+
+lv_obj_t *delta_anim_create(lv_obj_t *parent, struct delta_anim_player *player,
+                            uint32_t duration) {
+    player->obj = lv_img_create(parent);
+    lv_img_set_src(player->obj, &player->img);
+
+    // The timer goes away with the image
+    player->period = MAX(duration / player->anim->frame_count, 1);
+    player->timer = lv_timer_create(timer_cb, player->period, player);
+    player->running = true;
+    lv_obj_add_event_cb(player->obj, delete_cb, LV_EVENT_DELETE, player);
+
+    sys_slist_append(&players, &player->node);
+    player->governor.changed = governor_changed;
+    anim_governor_add(&player->governor);
+
+    return player->obj;
+}
+
+void delta_anim_set_running(struct delta_anim_player *player, bool running) {
+    if (player->running != running) {
+        player->running = running;
+        update_timer(player);
+    }
+}
+
+void delta_anim_set_paused(bool set_paused) {
+    struct delta_anim_player *player;
+
+    if (paused == set_paused) {
+        return;
+    }
+
+    paused = set_paused;
+    SYS_SLIST_FOR_EACH_CONTAINER(&players, player, node) { update_timer(player); }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <lvgl.h>
+#include "anim_governor.h"
+
+/*
+ * Delta-encoded 1 bpp animations, written by scripts/encode_animation.py.
+ *
+ * The stream holds frame 0 as a delta against a blank frame, then the
+ * run-length coded XOR delta from each frame to the next, looping back to
+ * frame 0. Frames are rebuilt one after another in a single scratch image,
+ * so the flash only holds the pixels that change and the RAM one frame.
+ */
+
+struct delta_anim {
+    uint16_t w;
+    uint16_t h;
+    uint16_t frame_count;
+    uint32_t loop; // stream offset of the delta from frame 0 to frame 1
+    const uint8_t *data;
+};
+
+struct delta_anim_player {
+    const struct delta_anim *anim;
+    lv_img_dsc_t img; // the current frame
+    lv_obj_t *obj;
+    lv_timer_t *timer;
+    uint32_t period; // ms per frame at full speed
+    bool running;
+    struct anim_governor_listener governor;
+    sys_snode_t node; // in the list of playing animations
+    uint32_t pos; // stream offset of the next delta
+    uint16_t frame;
+};
+
+// Scratch buffer size for a w x h animation: palette and one frame
+#define DELTA_ANIM_BUF_SIZE(w, h) LV_CANVAS_BUF_SIZE_INDEXED_1BIT(w, h)
+
+// Decode frame 0 of anim into buf, with bg and fg as the palette
+void delta_anim_init(struct delta_anim_player *player, const struct delta_anim *anim, uint8_t *buf,
+                     lv_color_t bg, lv_color_t fg);
+void delta_anim_next(struct delta_anim_player *player);
+void delta_anim_seek(struct delta_anim_player *player, uint16_t frame);
+
+// Image object playing the animation in a loop over duration ms, in place of
+// an lv_animimg. The frame rate follows the animation governor.
+lv_obj_t *delta_anim_create(lv_obj_t *parent, struct delta_anim_player *player,
+                            uint32_t duration);
+
+// Stop the animation of delta_anim_create() on its current frame, or let it
+// play on
+void delta_anim_set_running(struct delta_anim_player *player, bool running);
+
+// Hold every animation of delta_anim_create() on its current frame, e.g.
+// while the display is blanked, whatever the governor allows
+void delta_anim_set_paused(bool paused);
@@ -8,4 +8,7 @@ struct layer_status_state {
     const char *label;
 };
 
+/* Portrait canvas area owned by draw_layer_status() */
+#define LAYER_STATUS_AREA {.x1 = 0, .y1 = 144, .x2 = CANVAS_WIDTH - 1, .y2 = CANVAS_HEIGHT - 1}
+
 void draw_layer_status(lv_obj_t *canvas, const struct status_state *state);
\ No newline at end of file
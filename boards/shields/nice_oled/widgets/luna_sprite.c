@@ -0,0 +1,84 @@
+#include "luna_sprite.h"
+#include "anim_governor.h"
+
+static lv_obj_t *sprite;
+static const struct luna_sprite_clip *layers[LUNA_SPRITE_LAYER_COUNT];
+
+// Clip the sprite is playing, NULL while hidden
+static const struct luna_sprite_clip *shown;
+static bool paused;
+
+static void play(const struct luna_sprite_clip *clip) {
+    uint32_t period = paused ? 0 : anim_governor_period(clip->duration / clip->count);
+
+    lv_animimg_set_src(sprite, (const void **)clip->frames, clip->count);
+    if (period == 0) {
+        // Paused on the frame shown last, or the first one of a new clip
+        lv_anim_del(sprite, NULL);
+        if (clip != shown) {
+            lv_img_set_src(sprite, clip->frames[0]);
+        }
+        return;
+    }
+
+    lv_animimg_set_duration(sprite, period * clip->count);
+    lv_animimg_set_repeat_count(sprite, LV_ANIM_REPEAT_INFINITE);
+    lv_animimg_start(sprite);
+}
+
+static void update(bool restart) {
+    const struct luna_sprite_clip *clip = NULL;
+
+    for (int i = LUNA_SPRITE_LAYER_COUNT - 1; i >= 0 && clip == NULL; i--) {
+        clip = layers[i];
+    }
+
+    if (clip == shown && !restart) {
+        return;
+    }
+
+    if (clip == NULL) {
+        lv_anim_del(sprite, NULL);
+        lv_obj_add_flag(sprite, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        if (shown == NULL) {
+            lv_obj_clear_flag(sprite, LV_OBJ_FLAG_HIDDEN);
+        }
+        play(clip);
+    }
+
+    shown = clip;
+}
+
+static void governor_changed(struct anim_governor_listener *listener) {
+    // Restart the clip at the new frame rate
+    update(true);
+}
+
+static struct anim_governor_listener governor = {.changed = governor_changed};
+
+lv_obj_t *luna_sprite_create(lv_obj_t *parent) {
+    if (sprite == NULL) {
+        sprite = lv_animimg_create(parent);
+        lv_obj_add_flag(sprite, LV_OBJ_FLAG_HIDDEN);
+        anim_governor_add(&governor);
+    }
+
+    return sprite;
+}
+
+void luna_sprite_set(enum luna_sprite_layer layer, const struct luna_sprite_clip *clip) {
+    layers[layer] = clip;
+    update(false);
+}
+
+void luna_sprite_set_paused(bool set_paused) {
+    if (paused == set_paused) {
+        return;
+    }
+
+    paused = set_paused;
+    if (sprite != NULL) {
+        update(true);
+    }
+}
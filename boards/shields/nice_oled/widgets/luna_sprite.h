@@ -0,0 +1,40 @@
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+/*
+ * The one Luna sprite shared by the WPM, modifiers and HID indicators
+ * widgets. Each of them sets the clip of its own layer, and the sprite
+ * plays the clip of the highest layer that has one:
+ *
+ *   lock LED bark > modifier pose > WPM gait
+ *
+ * Switching clips only changes the frames of a single lv_animimg, which is
+ * hidden while no layer has a clip. The frame rate follows the animation
+ * governor, and luna_sprite_set_paused() stops it with or without one.
+ */
+
+enum luna_sprite_layer {
+    LUNA_SPRITE_WPM,
+    LUNA_SPRITE_MODIFIERS,
+    LUNA_SPRITE_HID_INDICATORS,
+    LUNA_SPRITE_LAYER_COUNT,
+};
+
+struct luna_sprite_clip {
+    const lv_img_dsc_t **frames;
+    uint8_t count;
+    uint32_t duration; // ms for one pass through the frames
+};
+
+#define LUNA_SPRITE_CLIP(imgs, ms) {.frames = imgs, .count = ARRAY_SIZE(imgs), .duration = ms}
+
+// The sprite object, created on the first call
+lv_obj_t *luna_sprite_create(lv_obj_t *parent);
+
+// Play clip on layer, or clear the layer with NULL
+void luna_sprite_set(enum luna_sprite_layer layer, const struct luna_sprite_clip *clip);
+
+// Hold the sprite on its current frame, e.g. while the display is blanked
+void luna_sprite_set_paused(bool paused);
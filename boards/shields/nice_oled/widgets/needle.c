@@ -0,0 +1,38 @@
+#include "needle.h"
+
+#define NEEDLE_STEPS 64
+
+// sin(psi) and cos(psi) in Q15 at NEEDLE_STEPS + 1 points across the sweep,
+// with the same degree to radian factor as the fixed range
+#define NEEDLE_STEP_PSI(i)                                                                         \
+    ((225 + 90.0 * (i) / NEEDLE_STEPS) * (3.14159 / 180) - NEEDLE_PI * 3 / 2)
+#define NEEDLE_Q15(x) ((x) * 32768 + ((x) < 0 ? -0.5 : 0.5))
+#define NEEDLE_SIN_Q15(i, _) (int16_t) NEEDLE_Q15(NEEDLE_SIN(NEEDLE_STEP_PSI(i)))
+#define NEEDLE_COS_Q15(i, _) (uint16_t) NEEDLE_Q15(NEEDLE_COS(NEEDLE_STEP_PSI(i)))
+
+// cos(psi) is positive across the sweep and reaches 1.0, hence unsigned
+static const int16_t needle_sin[NEEDLE_STEPS + 1] = {
+    LISTIFY(UTIL_INC(NEEDLE_STEPS), NEEDLE_SIN_Q15, (, ))};
+static const uint16_t needle_cos[NEEDLE_STEPS + 1] = {
+    LISTIFY(UTIL_INC(NEEDLE_STEPS), NEEDLE_COS_Q15, (, ))};
+
+static inline int32_t lerp(int32_t a, int32_t b, int32_t frac) {
+    return a + (((b - a) * frac) >> 8);
+}
+
+struct needle needle_get(uint32_t value, uint32_t max, int32_t offset, int32_t radius_q8) {
+    // Position along the sweep in 1/256 steps, then Q15 sin and cos of psi
+    uint32_t pos = MIN(value, max) * NEEDLE_STEPS * 256 / max;
+    uint32_t i = MIN(pos >> 8, NEEDLE_STEPS - 1);
+    int32_t frac = pos - (i << 8);
+    int32_t sin_q15 = lerp(needle_sin[i], needle_sin[i + 1], frac);
+    int32_t cos_q15 = -lerp(needle_cos[i], needle_cos[i + 1], frac);
+
+    // Divisions rather than shifts to truncate towards zero like a cast
+    return (struct needle){
+        .x1 = offset * sin_q15 / 32768,
+        .y1 = offset * cos_q15 / 32768,
+        .x2 = radius_q8 * sin_q15 / (32768 * 256),
+        .y2 = radius_q8 * cos_q15 / (32768 * 256),
+    };
+}
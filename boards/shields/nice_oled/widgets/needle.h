@@ -0,0 +1,55 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/*
+ * End points of the WPM gauge needle, shared by both shields.
+ *
+ * The needle turns clockwise from 225 to 315 degrees as the WPM goes from 0
+ * to the top of the range, i.e. by psi = -45..45 degrees from straight up,
+ * where cos(270 + psi) = sin(psi) and sin(270 + psi) = -cos(psi).
+ *
+ * A fixed range uses end points computed at build time for every WPM, with
+ * NEEDLE_ENTRY(), and an auto range interpolates a Q15 table of the same
+ * sweep with needle_get(), so drawing needs no floating point or libm.
+ */
+
+// Taylor series as constant expressions, within 1e-13 for |a| <= pi / 4
+#define NEEDLE_SIN(a)                                                                              \
+    ((a) * (1 - (a) * (a) / 6 *                                                                    \
+                    (1 - (a) * (a) / 20 *                                                          \
+                             (1 - (a) * (a) / 42 *                                                 \
+                                      (1 - (a) * (a) / 72 *                                        \
+                                               (1 - (a) * (a) / 110 * (1 - (a) * (a) / 156)))))))
+#define NEEDLE_COS(a)                                                                              \
+    (1 - (a) * (a) / 2 *                                                                           \
+             (1 - (a) * (a) / 12 *                                                                 \
+                      (1 - (a) * (a) / 30 *                                                        \
+                               (1 - (a) * (a) / 56 *                                               \
+                                        (1 - (a) * (a) / 90 *                                      \
+                                                 (1 - (a) * (a) / 132 * (1 - (a) * (a) / 182)))))))
+
+#define NEEDLE_PI 3.14159265358979323846
+
+// Same float angle and truncation as the former cos()/sin() versions
+#define NEEDLE_PSI(v, max)                                                                         \
+    ((double)(225 + ((float)(v) / (float)(max)) * 90) * (3.14159 / 180.0f) - NEEDLE_PI * 3 / 2)
+
+struct needle {
+    int8_t x1, y1, x2, y2;
+};
+
+// Entry v of a LISTIFY() table for WPM 0 to max, relative to the center
+#define NEEDLE_ENTRY(v, max, offset, radius)                                                       \
+    {                                                                                              \
+        (int8_t)((offset) * NEEDLE_SIN(NEEDLE_PSI(v, max))),                                       \
+        (int8_t)((offset) * -NEEDLE_COS(NEEDLE_PSI(v, max))),                                      \
+        (int8_t)((radius) * NEEDLE_SIN(NEEDLE_PSI(v, max))),                                       \
+        (int8_t)((radius) * -NEEDLE_COS(NEEDLE_PSI(v, max))),                                      \
+    }
+
+// Radius in 1/256 pixels, as needle_get() takes it
+#define NEEDLE_RADIUS_Q8(radius) ((int32_t)((radius) * 256 + 0.5))
+
+// End points at value out of max, within one pixel of the float version
+struct needle needle_get(uint32_t value, uint32_t max, int32_t offset, int32_t radius_q8);
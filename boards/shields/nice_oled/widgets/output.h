@@ -17,4 +17,7 @@ struct peripheral_status_state {
 };
 #endif
 
+/* Portrait canvas area owned by draw_output_status() */
+#define OUTPUT_STATUS_AREA {.x1 = 0, .y1 = 32, .x2 = CANVAS_WIDTH - 1, .y2 = 47}
+
 void draw_output_status(lv_obj_t *canvas, const struct status_state *state);
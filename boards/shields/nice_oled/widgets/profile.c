@@ -6,12 +6,11 @@
 
 LV_IMG_DECLARE(profiles);
 
-static void draw_inactive_profiles(lv_obj_t *canvas,
-                                   const struct status_state *state) {
+static void draw_inactive_profiles(lv_obj_t *canvas) {
   lv_draw_img_dsc_t img_dsc;
   lv_draw_img_dsc_init(&img_dsc);
 
-  lv_canvas_draw_img(canvas, 0, 137, &profiles, &img_dsc);
+  canvas_draw_img(canvas, 0, 137, &profiles, &img_dsc);
   // lv_canvas_draw_img(canvas, 18, 129, &profiles, &img_dsc);
 }
 
@@ -22,7 +21,7 @@ static void draw_active_profile(lv_obj_t *canvas,
 
   int offset = state->active_profile_index * 7;
 
-  lv_canvas_draw_rect(canvas, 0 + offset, 137, 3, 3, &rect_white_dsc);
+  canvas_draw_rect(canvas, 0 + offset, 137, 3, 3, &rect_white_dsc);
   // lv_canvas_draw_rect(canvas, 18 + offset, 129, 3, 3, &rect_white_dsc);
 }
 
@@ -38,11 +37,14 @@ static void draw_active_profile_text(lv_obj_t *canvas,
   char text[14] = {};
   snprintf(text, sizeof(text), "%d", state->active_profile_index + 1);
 
-  lv_canvas_draw_text(canvas, 25, 32, 35, &label_dsc, text);
+  canvas_draw_text(canvas, 25, 32, 35, &label_dsc, text);
+}
+
+void draw_profile_background(lv_obj_t *canvas) {
+  draw_inactive_profiles(canvas);
 }
 
 void draw_profile_status(lv_obj_t *canvas, const struct status_state *state) {
   draw_active_profile_text(canvas, state);
-  draw_inactive_profiles(canvas, state);
   draw_active_profile(canvas, state);
 }
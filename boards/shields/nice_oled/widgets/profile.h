@@ -3,4 +3,13 @@
 #include <lvgl.h>
 #include "util.h"
 
+/*
+ * Portrait canvas area owned by draw_profile_status(). The active profile
+ * number is also written inside OUTPUT_STATUS_AREA, so both areas are always
+ * repainted together on STATUS_DIRTY_OUTPUT.
+ */
+#define PROFILE_STATUS_AREA {.x1 = 0, .y1 = 131, .x2 = CANVAS_WIDTH - 1, .y2 = 143}
+
+// Static art of the area, drawn once into the saved background
+void draw_profile_background(lv_obj_t *canvas);
 void draw_profile_status(lv_obj_t *canvas, const struct status_state *state);
\ No newline at end of file
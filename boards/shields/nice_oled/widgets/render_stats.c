@@ -0,0 +1,142 @@
+#include "render_stats.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+#include <lvgl_mem.h>
+#endif
+
+#if IS_ENABLED(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+#if IS_ENABLED(CONFIG_ARCH_POSIX) && IS_ENABLED(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+
+#define TICKS_PER_SEC NSEC_PER_SEC
+
+// Host nanoseconds, which wrap like the cycle counter does
+uint32_t render_stats_now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+}
+
+static uint32_t ticks_to_ns(uint32_t ticks) { return ticks; }
+#else
+#define TICKS_PER_SEC sys_clock_hw_cycles_per_sec()
+
+uint32_t render_stats_now(void) { return k_cycle_get_32(); }
+
+static uint32_t ticks_to_ns(uint32_t ticks) { return k_cyc_to_ns_floor64(ticks); }
+#endif
+
+static struct {
+    uint32_t start;
+    uint32_t pixels;
+    uint32_t bytes;
+    uint32_t flushed;
+} frame;
+
+static render_stats_frame_cb_t frame_cb;
+
+static struct part_stats {
+    uint32_t calls;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} parts[RENDER_STATS_PART_COUNT];
+
+static const char *const part_names[RENDER_STATS_PART_COUNT] = {
+    [RENDER_STATS_FRAME] = "frame",     [RENDER_STATS_BACKGROUND] = "background",
+    [RENDER_STATS_OUTPUT] = "output",   [RENDER_STATS_BATTERY] = "battery",
+    [RENDER_STATS_WPM] = "wpm",         [RENDER_STATS_PROFILE] = "profile",
+    [RENDER_STATS_LAYER] = "layer",
+};
+
+void render_stats_add_cycles(enum render_stats_part part, uint32_t cycles) {
+    struct part_stats *stats = &parts[part];
+
+    if (stats->calls == 0 || cycles < stats->min) {
+        stats->min = cycles;
+    }
+    stats->max = MAX(stats->max, cycles);
+    stats->total += cycles;
+    stats->calls++;
+}
+
+void render_stats_set_frame_cb(render_stats_frame_cb_t cb) { frame_cb = cb; }
+
+void render_stats_frame_begin(void) {
+    frame.start = render_stats_now();
+    frame.pixels = 0;
+    frame.bytes = 0;
+    frame.flushed = 0;
+}
+
+void render_stats_add_area(const lv_area_t *area) {
+    // Canvas rows are packed 8 pixels per byte, so count whole bytes per row
+    frame.pixels += lv_area_get_size(area);
+    frame.bytes += lv_area_get_height(area) * ((area->x2 >> 3) - (area->x1 >> 3) + 1);
+}
+
+void render_stats_add_flush(const lv_area_t *area) {
+    // 1 bpp panels take 8 pixels per byte, a column of a page or 8 of a line
+    frame.flushed += DIV_ROUND_UP(lv_area_get_size(area), 8);
+}
+
+void render_stats_frame_end(void) {
+    uint32_t cycles = render_stats_now() - frame.start;
+    size_t heap_max = 0;
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+    struct sys_memory_stats stats;
+
+    lvgl_heap_stats(&stats);
+    heap_max = stats.max_allocated_bytes;
+#endif
+
+    render_stats_add_cycles(RENDER_STATS_FRAME, cycles);
+    LOG_INF("frame %u: %u us, %u px, %u bytes, %u flushed, lvgl heap max %zu",
+            parts[RENDER_STATS_FRAME].calls, ticks_to_ns(cycles) / NSEC_PER_USEC, frame.pixels,
+            frame.bytes, frame.flushed, heap_max);
+
+    if (frame_cb != NULL) {
+        frame_cb(&(struct render_stats_frame){
+            .ns = ticks_to_ns(cycles),
+            .pixels = frame.pixels,
+            .bytes = frame.bytes,
+            .flushed = frame.flushed,
+            .heap_max = heap_max,
+        });
+    }
+}
+
+#if IS_ENABLED(CONFIG_SHELL)
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    shell_print(sh, "cycles at %u Hz", TICKS_PER_SEC);
+    shell_print(sh, "%-10s %8s %10s %10s %10s", "part", "calls", "min", "avg", "max");
+
+    for (int i = 0; i < RENDER_STATS_PART_COUNT; i++) {
+        const struct part_stats *stats = &parts[i];
+        uint32_t avg = stats->calls ? stats->total / stats->calls : 0;
+
+        shell_print(sh, "%-10s %8u %10u %10u %10u", part_names[i], stats->calls, stats->min, avg,
+                    stats->max);
+    }
+
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_nice_oled,
+                               SHELL_CMD(stats, NULL, "Print status screen render timings",
+                                         cmd_stats),
+                               SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(nice_oled, &sub_nice_oled, "nice!oled status screen commands", NULL);
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+/*
+ * Status screen render statistics.
+ *
+ * A frame is everything drawn between render_stats_frame_begin() and
+ * render_stats_frame_end(). The canvas draw helpers report the areas they
+ * touch, and the frame end logs its CPU time, the pixels and 1 bpp buffer
+ * bytes touched, the bytes a page flush sends to the panel, and the LVGL
+ * heap high-water mark.
+ *
+ * The frame and each part wrapped in RENDER_STATS_MEASURE() also collect
+ * cycle counts (calls, min, avg, max), printed by the "nice_oled stats"
+ * shell command when CONFIG_SHELL is enabled. On native_sim, where code
+ * takes no simulated time, they count host nanoseconds instead, as long as
+ * CONFIG_EXTERNAL_LIBC gives access to the host clock.
+ *
+ * Everything compiles to nothing unless CONFIG_NICE_OLED_RENDER_STATS is set.
+ */
+
+enum render_stats_part {
+    RENDER_STATS_FRAME,
+    RENDER_STATS_BACKGROUND,
+    RENDER_STATS_OUTPUT,
+    RENDER_STATS_BATTERY,
+    RENDER_STATS_WPM,
+    RENDER_STATS_PROFILE,
+    RENDER_STATS_LAYER,
+    RENDER_STATS_PART_COUNT,
+};
+
+// What render_stats_frame_end() measured
+struct render_stats_frame {
+    uint32_t ns;
+    uint32_t pixels;
+    uint32_t bytes;
+    uint32_t flushed;
+    size_t heap_max;
+};
+
+typedef void (*render_stats_frame_cb_t)(const struct render_stats_frame *frame);
+
+#if IS_ENABLED(CONFIG_NICE_OLED_RENDER_STATS)
+uint32_t render_stats_now(void);
+void render_stats_frame_begin(void);
+void render_stats_frame_end(void);
+void render_stats_add_area(const lv_area_t *area);
+void render_stats_add_flush(const lv_area_t *area);
+void render_stats_add_cycles(enum render_stats_part part, uint32_t cycles);
+// Also hand every frame to cb, e.g. for a benchmark to collect
+void render_stats_set_frame_cb(render_stats_frame_cb_t cb);
+
+// Time call, a statement or a { } block, as one call of part
+#define RENDER_STATS_MEASURE(part, call)                                                           \
+    do {                                                                                           \
+        uint32_t start_ = render_stats_now();                                                      \
+        call;                                                                                      \
+        render_stats_add_cycles(part, render_stats_now() - start_);                                \
+    } while (0)
+#else
+static inline void render_stats_frame_begin(void) {}
+static inline void render_stats_frame_end(void) {}
+static inline void render_stats_add_area(const lv_area_t *area) { ARG_UNUSED(area); }
+static inline void render_stats_add_flush(const lv_area_t *area) { ARG_UNUSED(area); }
+static inline void render_stats_set_frame_cb(render_stats_frame_cb_t cb) { ARG_UNUSED(cb); }
+
+#define RENDER_STATS_MEASURE(part, call) call
+#endif
@@ -0,0 +1,144 @@
+#include "rle_img.h"
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#define PALETTE_SIZE (2 * sizeof(lv_color32_t))
+
+void rle_img_reader_init(struct rle_img_reader *reader, const lv_img_dsc_t *img) {
+    reader->in = img->data + PALETTE_SIZE;
+    reader->end = img->data + img->data_size;
+    reader->count = 0;
+    reader->repeat = false;
+}
+
+void rle_img_read(struct rle_img_reader *reader, uint8_t *dst, uint32_t len) {
+    while (len > 0) {
+        if (reader->count == 0) {
+            if (reader->in >= reader->end) {
+                if (dst) {
+                    memset(dst, 0, len);
+                }
+                return;
+            }
+
+            uint8_t ctrl = *reader->in++;
+            reader->repeat = ctrl & 0x80;
+            reader->count = reader->repeat ? ctrl - 0x7e : ctrl + 1;
+        }
+
+        uint32_t n = MIN(len, reader->count);
+        if (dst) {
+            if (reader->repeat) {
+                memset(dst, *reader->in, n);
+            } else {
+                memcpy(dst, reader->in, n);
+            }
+            dst += n;
+        }
+
+        reader->count -= n;
+        len -= n;
+
+        // A literal moves along with the output, a repeat past its one byte
+        if (!reader->repeat) {
+            reader->in += n;
+        } else if (reader->count == 0) {
+            reader->in++;
+        }
+    }
+}
+
+// Decoder state of an open image: the last row read and its position
+struct rle_img_line {
+    struct rle_img_reader reader;
+    lv_coord_t row;
+    lv_color_t colors[2];
+    uint8_t bits[];
+};
+
+static bool is_rle_img(const void *src) {
+    return lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE &&
+           ((const lv_img_dsc_t *)src)->header.cf == RLE_IMG_CF;
+}
+
+static lv_res_t decoder_info(lv_img_decoder_t *decoder, const void *src,
+                             lv_img_header_t *header) {
+    LV_UNUSED(decoder);
+
+    if (!is_rle_img(src)) {
+        return LV_RES_INV;
+    }
+
+    *header = ((const lv_img_dsc_t *)src)->header;
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+
+    if (!is_rle_img(dsc->src)) {
+        return LV_RES_INV;
+    }
+
+    const lv_img_dsc_t *img = dsc->src;
+    struct rle_img_line *line = lv_mem_alloc(sizeof(*line) + ((img->header.w + 7) >> 3));
+    if (line == NULL) {
+        return LV_RES_INV;
+    }
+
+    const lv_color32_t *palette = (const lv_color32_t *)img->data;
+    for (int i = 0; i < 2; i++) {
+        line->colors[i] = lv_color_make(palette[i].ch.red, palette[i].ch.green, palette[i].ch.blue);
+    }
+
+    rle_img_reader_init(&line->reader, img);
+    line->row = -1;
+
+    // No img_data, LVGL reads the rows through decoder_read_line()
+    dsc->img_data = NULL;
+    dsc->user_data = line;
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf) {
+    LV_UNUSED(decoder);
+
+    const lv_img_dsc_t *img = dsc->src;
+    struct rle_img_line *line = dsc->user_data;
+    uint32_t stride = (img->header.w + 7) >> 3;
+
+    // Rows are drawn top to bottom, going back means starting over
+    if (y < line->row) {
+        rle_img_reader_init(&line->reader, img);
+        line->row = -1;
+    }
+    if (y > line->row) {
+        rle_img_read(&line->reader, NULL, (y - line->row - 1) * stride);
+        rle_img_read(&line->reader, line->bits, stride);
+        line->row = y;
+    }
+
+    lv_color_t *px = (lv_color_t *)buf;
+    for (lv_coord_t i = 0; i < len; i++, x++) {
+        px[i] = line->colors[(line->bits[x >> 3] >> (7 - (x & 7))) & 1];
+    }
+
+    return LV_RES_OK;
+}
+
+static void decoder_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc) {
+    LV_UNUSED(decoder);
+
+    lv_mem_free(dsc->user_data);
+    dsc->user_data = NULL;
+}
+
+void rle_img_decoder_init(void) {
+    lv_img_decoder_t *decoder = lv_img_decoder_create();
+
+    lv_img_decoder_set_info_cb(decoder, decoder_info);
+    lv_img_decoder_set_open_cb(decoder, decoder_open);
+    lv_img_decoder_set_read_line_cb(decoder, decoder_read_line);
+    lv_img_decoder_set_close_cb(decoder, decoder_close);
+}
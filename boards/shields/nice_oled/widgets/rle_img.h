@@ -0,0 +1,35 @@
+#pragma once
+
+#include <lvgl.h>
+
+/*
+ * Run-length encoded 1 bpp images, written by scripts/encode_image.py.
+ *
+ * The data starts with the same two palette entries as an
+ * LV_IMG_CF_INDEXED_1BIT image, followed by its byte-padded rows as runs:
+ *
+ *   0x00-0x7f  n + 1 literal bytes follow
+ *   0x80-0xff  the next byte repeated n - 0x7e times
+ *
+ * canvas_draw_img() decodes them straight into the canvas. Image objects
+ * such as lv_img and lv_animimg go through the decoder registered by
+ * rle_img_decoder_init(), which decodes one row at a time, so no full
+ * bitmap is ever held in RAM. That decoder draws the palette opaque.
+ */
+
+#define RLE_IMG_CF LV_IMG_CF_USER_ENCODED_0
+
+struct rle_img_reader {
+    const uint8_t *in;
+    const uint8_t *end;
+    uint8_t count; // bytes left in the current run
+    bool repeat;
+};
+
+void rle_img_reader_init(struct rle_img_reader *reader, const lv_img_dsc_t *img);
+
+// Decode the next len bitmap bytes into dst, or skip them if dst is NULL.
+// Bytes past the end of the data read as 0.
+void rle_img_read(struct rle_img_reader *reader, uint8_t *dst, uint32_t len);
+
+void rle_img_decoder_init(void);
@@ -3,11 +3,13 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
+#include <zmk/activity.h>
 #include <zmk/battery.h>
 #include <zmk/ble.h>
 #include <zmk/display.h>
 #include <zmk/endpoints.h>
 #include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
 #include <zmk/events/battery_state_changed.h>
 #include <zmk/events/ble_active_profile_changed.h>
 #include <zmk/events/endpoint_changed.h>
@@ -20,8 +22,10 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #include "battery.h"
 #include "layer.h"
+#include "luna_sprite.h"
 #include "output.h"
 #include "profile.h"
+#include "render_stats.h"
 #include "screen.h"
 #include "wpm.h"
 
@@ -57,34 +61,169 @@ static struct zmk_widget_hid_indicators hid_indicators_widget;
  * Draw canvas
  **/
 
-static void draw_canvas(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
+static const lv_area_t output_area = OUTPUT_STATUS_AREA;
+static const lv_area_t battery_area = BATTERY_STATUS_AREA;
+static const lv_area_t wpm_area = WPM_STATUS_AREA;
+static const lv_area_t profile_area = PROFILE_STATUS_AREA;
+static const lv_area_t layer_area = LAYER_STATUS_AREA;
+
+static void draw_canvas(struct zmk_widget_screen *widget, uint8_t dirty) {
+    lv_obj_t *canvas = widget->canvas;
+    const uint8_t *background = widget->bgbuf;
+    const struct status_state *state = &widget->state;
+
+    render_stats_frame_begin();
+
+    // Repaint only the areas whose state changed, starting from the saved
+    // static art; the canvas draw helpers rotate for horizontal display and
+    // flush just what they touched
+    if (dirty & STATUS_DIRTY_OUTPUT) {
+        RENDER_STATS_MEASURE(RENDER_STATS_BACKGROUND, {
+            restore_background_area(canvas, background, &output_area);
+            restore_background_area(canvas, background, &profile_area);
+        });
+        RENDER_STATS_MEASURE(RENDER_STATS_OUTPUT, draw_output_status(canvas, state));
+        RENDER_STATS_MEASURE(RENDER_STATS_PROFILE, draw_profile_status(canvas, state));
+    }
 
-    // Draw widgets
-    draw_background(canvas);
-    draw_output_status(canvas, state);
-    draw_battery_status(canvas, state);
-    draw_wpm_status(canvas, state);
-    draw_profile_status(canvas, state);
-    draw_layer_status(canvas, state);
+    if (dirty & STATUS_DIRTY_BATTERY) {
+        RENDER_STATS_MEASURE(RENDER_STATS_BACKGROUND,
+                             restore_background_area(canvas, background, &battery_area));
+        RENDER_STATS_MEASURE(RENDER_STATS_BATTERY, draw_battery_status(canvas, state));
+    }
+
+    if (dirty & STATUS_DIRTY_WPM) {
+        RENDER_STATS_MEASURE(RENDER_STATS_BACKGROUND,
+                             restore_background_area(canvas, background, &wpm_area));
+        RENDER_STATS_MEASURE(RENDER_STATS_WPM, draw_wpm_status(canvas, state));
+    }
+
+    if (dirty & STATUS_DIRTY_LAYER) {
+        RENDER_STATS_MEASURE(RENDER_STATS_BACKGROUND,
+                             restore_background_area(canvas, background, &layer_area));
+        RENDER_STATS_MEASURE(RENDER_STATS_LAYER, draw_layer_status(canvas, state));
+    }
+
+#if IS_ENABLED(CONFIG_NICE_OLED_PAGE_FLUSH)
+    canvas_flush_pages(canvas);
+#endif
+
+    render_stats_frame_end();
+}
+
+/**
+ * Render scheduling
+ **/
+
+#define RENDER_PERIOD_MS (1000 / CONFIG_NICE_OLED_MAX_FPS)
 
-    // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+// Updates merged into an already scheduled render
+static uint32_t renders_saved;
+
+static void render_work_handler(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct zmk_widget_screen *widget = CONTAINER_OF(dwork, struct zmk_widget_screen, render_work);
+    uint8_t dirty = widget->dirty;
+
+    widget->dirty = 0;
+    widget->last_render = k_uptime_get();
+    draw_canvas(widget, dirty);
+
+    LOG_DBG("status screen rendered, %u renders saved", renders_saved);
+}
+
+// Mark state dirty and render it once, no sooner than RENDER_PERIOD_MS after
+// the previous render. Runs on the display work queue like the listeners.
+static void schedule_render(struct zmk_widget_screen *widget, uint8_t dirty) {
+    if (widget->dirty) {
+        renders_saved++;
+    }
+    widget->dirty |= dirty;
+
+    // Only the latest state is kept, and rendered once the display wakes up
+    if (widget->blanked) {
+        return;
+    }
+
+    int64_t wait = widget->last_render + RENDER_PERIOD_MS - k_uptime_get();
+    k_work_schedule_for_queue(zmk_display_work_q(), &widget->render_work,
+                              K_MSEC(CLAMP(wait, 0, RENDER_PERIOD_MS)));
+}
+
+// Updates dropped because they would not change what is shown
+static uint32_t frames_suppressed;
+
+// Render a part of the status only if its visible inputs changed; each part
+// is always drawn at least once
+static void update_status(struct zmk_widget_screen *widget, uint8_t part, bool changed) {
+    if (!changed && (widget->drawn & part)) {
+        frames_suppressed++;
+        LOG_DBG("status screen unchanged, %u frames suppressed", frames_suppressed);
+        return;
+    }
+
+    widget->drawn |= part;
+    schedule_render(widget, part);
 }
 
+/**
+ * Display blanking
+ **/
+
+#if IS_ENABLED(CONFIG_ZMK_DISPLAY_BLANK_ON_IDLE)
+struct blanking_state {
+    bool blanked;
+};
+
+static void set_blanked(struct zmk_widget_screen *widget, bool blanked) {
+    widget->blanked = blanked;
+
+    if (blanked) {
+        // Whatever is dirty stays dirty for the catch-up render
+        k_work_cancel_delayable(&widget->render_work);
+    } else if (widget->dirty) {
+        k_work_schedule_for_queue(zmk_display_work_q(), &widget->render_work, K_NO_WAIT);
+    }
+}
+
+static void blanking_update_cb(struct blanking_state state) {
+    struct zmk_widget_screen *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_blanked(widget, state.blanked); }
+
+    // Nothing is shown, so the sprite has no frames to draw either
+    luna_sprite_set_paused(state.blanked);
+}
+
+static struct blanking_state blanking_get_state(const zmk_event_t *eh) {
+    const struct zmk_activity_state_changed *ev = as_zmk_activity_state_changed(eh);
+    enum zmk_activity_state state = ev != NULL ? ev->state : zmk_activity_get_state();
+
+    // ZMK blanks the display as soon as the keyboard is no longer active
+    return (struct blanking_state){.blanked = state != ZMK_ACTIVITY_ACTIVE};
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(widget_blanking, struct blanking_state, blanking_update_cb,
+                            blanking_get_state)
+
+ZMK_SUBSCRIPTION(widget_blanking, zmk_activity_state_changed);
+#endif /* IS_ENABLED(CONFIG_ZMK_DISPLAY_BLANK_ON_IDLE) */
+
 /**
  * Battery status
  **/
 
 static void set_battery_status(struct zmk_widget_screen *widget,
                                struct battery_status_state state) {
+    bool changed = widget->state.battery != state.level;
+
 #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+    changed |= widget->state.charging != state.usb_present;
     widget->state.charging = state.usb_present;
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
 
     widget->state.battery = state.level;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    update_status(widget, STATUS_DIRTY_BATTERY, changed);
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
@@ -116,10 +255,13 @@ ZMK_SUBSCRIPTION(widget_battery_status, zmk_usb_conn_state_changed);
  **/
 
 static void set_layer_status(struct zmk_widget_screen *widget, struct layer_status_state state) {
+    bool changed =
+        widget->state.layer_index != state.index || widget->state.layer_label != state.label;
+
     widget->state.layer_index = state.index;
     widget->state.layer_label = state.label;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    update_status(widget, STATUS_DIRTY_LAYER, changed);
 }
 
 static void layer_status_update_cb(struct layer_status_state state) {
@@ -143,12 +285,18 @@ ZMK_SUBSCRIPTION(widget_layer_status, zmk_layer_state_changed);
 
 static void set_output_status(struct zmk_widget_screen *widget,
                               const struct output_status_state *state) {
+    bool changed =
+        !zmk_endpoint_instance_eq(widget->state.selected_endpoint, state->selected_endpoint) ||
+        widget->state.active_profile_index != state->active_profile_index ||
+        widget->state.active_profile_connected != state->active_profile_connected ||
+        widget->state.active_profile_bonded != state->active_profile_bonded;
+
     widget->state.selected_endpoint = state->selected_endpoint;
     widget->state.active_profile_index = state->active_profile_index;
     widget->state.active_profile_connected = state->active_profile_connected;
     widget->state.active_profile_bonded = state->active_profile_bonded;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    update_status(widget, STATUS_DIRTY_OUTPUT, changed);
 }
 
 static void output_status_update_cb(struct output_status_state state) {
@@ -181,12 +329,21 @@ ZMK_SUBSCRIPTION(widget_output_status, zmk_ble_active_profile_changed);
  **/
 
 static void set_wpm_status(struct zmk_widget_screen *widget, struct wpm_status_state state) {
-    for (int i = 0; i < 9; i++) {
-        widget->state.wpm[i] = widget->state.wpm[i + 1];
-    }
-    widget->state.wpm[9] = state.wpm;
+    struct wpm_history *history = &widget->state.wpm;
+
+#if IS_ENABLED(CONFIG_NICE_OLED_WIDGET_WPM_LUNA) &&                                               \
+    IS_ENABLED(CONFIG_NICE_OLED_GEM_ANIMATION_WPM_FIXED_RANGE)
+    // Without the graph or an auto range only the latest sample is shown
+    bool changed = wpm_history_last(history) != state.wpm;
+#else
+    // Adding a sample equal to the whole history leaves it as it is, which
+    // is what happens every interval while idle at 0 WPM
+    bool changed = wpm_history_min(history) != state.wpm || wpm_history_max(history) != state.wpm;
+#endif
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    wpm_history_push(history, state.wpm);
+
+    update_status(widget, STATUS_DIRTY_WPM, changed);
 }
 
 static void wpm_status_update_cb(struct wpm_status_state state) {
@@ -212,13 +369,32 @@ int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent) {
 
     lv_obj_t *canvas = lv_canvas_create(widget->obj);
     lv_obj_align(canvas, LV_ALIGN_TOP_LEFT, 0, 0);
-    lv_canvas_set_buffer(canvas, widget->cbuf, CANVAS_HEIGHT, CANVAS_HEIGHT, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_set_buffer(canvas, widget->cbuf, CANVAS_HEIGHT, CANVAS_WIDTH, LV_IMG_CF_INDEXED_1BIT);
+    lv_canvas_set_palette(canvas, 0, LVGL_BACKGROUND);
+    lv_canvas_set_palette(canvas, 1, LVGL_FOREGROUND);
+    widget->canvas = canvas;
+
+    // Compose the static art once; frames restore it and draw the rest on top
+    draw_background(canvas);
+    draw_wpm_background(canvas);
+    draw_profile_background(canvas);
+    canvas_save(canvas, widget->bgbuf);
+#if IS_ENABLED(CONFIG_NICE_OLED_PAGE_FLUSH)
+    canvas_track_pages(canvas, widget->shadow);
+#endif
+
+    k_work_init_delayable(&widget->render_work, render_work_handler);
+
+    wpm_history_init(&widget->state.wpm);
 
     sys_slist_append(&widgets, &widget->node);
     widget_battery_status_init();
     widget_layer_status_init();
     widget_output_status_init();
     widget_wpm_status_init();
+#if IS_ENABLED(CONFIG_ZMK_DISPLAY_BLANK_ON_IDLE)
+    widget_blanking_init();
+#endif
 
 #if IS_ENABLED(CONFIG_NICE_OLED_WIDGET_WPM)
     zmk_widget_luna_init(&luna_widget, canvas);
@@ -9,8 +9,20 @@
 struct zmk_widget_screen {
   sys_snode_t node;
   lv_obj_t *obj;
-  lv_color_t cbuf[CANVAS_HEIGHT * CANVAS_HEIGHT];
+  lv_obj_t *canvas;
+  uint8_t cbuf[CANVAS_BUF_SIZE(CANVAS_HEIGHT, CANVAS_WIDTH)];
+  // The canvas with only its static art, restored under each repainted area
+  uint8_t bgbuf[CANVAS_BUF_SIZE(CANVAS_HEIGHT, CANVAS_WIDTH)];
+#if IS_ENABLED(CONFIG_NICE_OLED_PAGE_FLUSH)
+  // What the panel shows, to flush only the pages that change
+  uint8_t shadow[CANVAS_BUF_SIZE(CANVAS_HEIGHT, CANVAS_WIDTH)];
+#endif
   struct status_state state;
+  struct k_work_delayable render_work;
+  int64_t last_render;
+  uint8_t dirty;
+  uint8_t drawn;
+  bool blanked;
 };
 
 int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent);
@@ -3,10 +3,12 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
+#include <zmk/activity.h>
 #include <zmk/battery.h>
 #include <zmk/ble.h>
 #include <zmk/display.h>
 #include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
 #include <zmk/events/battery_state_changed.h>
 #include <zmk/events/split_peripheral_status_changed.h>
 #include <zmk/events/usb_conn_state_changed.h>
@@ -15,7 +17,9 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #include "animation.h"
 #include "battery.h"
+#include "delta_anim.h"
 #include "output.h"
+#include "render_stats.h"
 #include "screen_peripheral.h"
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
@@ -24,18 +28,89 @@ static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
  * Draw canvas
  **/
 
-static void draw_canvas(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
+static void draw_canvas(lv_obj_t *widget, const struct status_state *state) {
     lv_obj_t *canvas = lv_obj_get_child(widget, 0);
 
-    // Draw widgets
-    draw_background(canvas);
-    draw_output_status(canvas, state);
-    draw_battery_status(canvas, state);
+    render_stats_frame_begin();
 
-    // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+    // Draw widgets, already rotated for horizontal display
+    RENDER_STATS_MEASURE(RENDER_STATS_BACKGROUND, draw_background(canvas));
+    RENDER_STATS_MEASURE(RENDER_STATS_OUTPUT, draw_output_status(canvas, state));
+    RENDER_STATS_MEASURE(RENDER_STATS_BATTERY, draw_battery_status(canvas, state));
+
+    render_stats_frame_end();
 }
 
+/**
+ * Render scheduling
+ **/
+
+#define RENDER_PERIOD_MS (1000 / CONFIG_NICE_OLED_MAX_FPS)
+
+static void render_work_handler(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct zmk_widget_screen *widget = CONTAINER_OF(dwork, struct zmk_widget_screen, render_work);
+
+    widget->dirty = false;
+    widget->last_render = k_uptime_get();
+    draw_canvas(widget->obj, &widget->state);
+}
+
+// Mark the state dirty and render it once, no sooner than RENDER_PERIOD_MS
+// after the previous render, as screen.c does
+static void schedule_render(struct zmk_widget_screen *widget) {
+    widget->dirty = true;
+
+    // Only the latest state is kept, and rendered once the display wakes up
+    if (widget->blanked) {
+        return;
+    }
+
+    int64_t wait = widget->last_render + RENDER_PERIOD_MS - k_uptime_get();
+    k_work_schedule_for_queue(zmk_display_work_q(), &widget->render_work,
+                              K_MSEC(CLAMP(wait, 0, RENDER_PERIOD_MS)));
+}
+
+/**
+ * Display blanking
+ **/
+
+#if IS_ENABLED(CONFIG_ZMK_DISPLAY_BLANK_ON_IDLE)
+struct blanking_state {
+    bool blanked;
+};
+
+static void set_blanked(struct zmk_widget_screen *widget, bool blanked) {
+    widget->blanked = blanked;
+
+    if (blanked) {
+        k_work_cancel_delayable(&widget->render_work);
+    } else if (widget->dirty) {
+        k_work_schedule_for_queue(zmk_display_work_q(), &widget->render_work, K_NO_WAIT);
+    }
+}
+
+static void blanking_update_cb(struct blanking_state state) {
+    struct zmk_widget_screen *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_blanked(widget, state.blanked); }
+
+    // Nothing is shown, so the animations have no frames to draw either
+    delta_anim_set_paused(state.blanked);
+}
+
+static struct blanking_state blanking_get_state(const zmk_event_t *eh) {
+    const struct zmk_activity_state_changed *ev = as_zmk_activity_state_changed(eh);
+    enum zmk_activity_state state = ev != NULL ? ev->state : zmk_activity_get_state();
+
+    return (struct blanking_state){.blanked = state != ZMK_ACTIVITY_ACTIVE};
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(widget_blanking, struct blanking_state, blanking_update_cb,
+                            blanking_get_state)
+
+ZMK_SUBSCRIPTION(widget_blanking, zmk_activity_state_changed);
+#endif /* IS_ENABLED(CONFIG_ZMK_DISPLAY_BLANK_ON_IDLE) */
+
 /**
  * Battery status
  **/
@@ -49,7 +124,7 @@ static void set_battery_status(struct zmk_widget_screen *widget,
 
     widget->state.battery = state.level;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    schedule_render(widget);
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
@@ -88,7 +163,7 @@ static void set_connection_status(struct zmk_widget_screen *widget,
                                   struct peripheral_status_state state) {
     widget->state.connected = state.connected;
 
-    draw_canvas(widget->obj, widget->cbuf, &widget->state);
+    schedule_render(widget);
 }
 
 static void output_status_update_cb(struct peripheral_status_state state) {
@@ -110,12 +185,19 @@ int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent) {
 
     lv_obj_t *canvas = lv_canvas_create(widget->obj);
     lv_obj_align(canvas, LV_ALIGN_TOP_LEFT, 0, 0);
-    lv_canvas_set_buffer(canvas, widget->cbuf, CANVAS_HEIGHT, CANVAS_HEIGHT, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_set_buffer(canvas, widget->cbuf, CANVAS_HEIGHT, CANVAS_WIDTH, LV_IMG_CF_INDEXED_1BIT);
+    lv_canvas_set_palette(canvas, 0, LVGL_BACKGROUND);
+    lv_canvas_set_palette(canvas, 1, LVGL_FOREGROUND);
+
+    k_work_init_delayable(&widget->render_work, render_work_handler);
 
     sys_slist_append(&widgets, &widget->node);
     draw_animation(canvas, widget);
     widget_battery_status_init();
     widget_peripheral_status_init();
+#if IS_ENABLED(CONFIG_ZMK_DISPLAY_BLANK_ON_IDLE)
+    widget_blanking_init();
+#endif
 
     return 0;
 }
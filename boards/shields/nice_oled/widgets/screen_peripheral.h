@@ -7,8 +7,12 @@
 struct zmk_widget_screen {
     sys_snode_t node;
     lv_obj_t *obj;
-    lv_color_t cbuf[CANVAS_HEIGHT * CANVAS_HEIGHT];
+    uint8_t cbuf[CANVAS_BUF_SIZE(CANVAS_HEIGHT, CANVAS_WIDTH)];
     struct status_state state;
+    struct k_work_delayable render_work;
+    int64_t last_render;
+    bool dirty;
+    bool blanked;
 };
 
 int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent);
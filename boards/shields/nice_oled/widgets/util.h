@@ -1,17 +1,18 @@
 #pragma once
 
+#include "canvas.h"
+#include "wpm_history.h"
 #include <lvgl.h>
 #include <zmk/endpoints.h>
 
 #define CANVAS_WIDTH 68
 #define CANVAS_HEIGHT 160
 
-#define LVGL_BACKGROUND                                                        \
-  IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_black()              \
-                                               : lv_color_white()
-#define LVGL_FOREGROUND                                                        \
-  IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_white()              \
-                                               : lv_color_black()
+/* Parts of status_state that changed since the last draw_canvas() */
+#define STATUS_DIRTY_OUTPUT BIT(0)
+#define STATUS_DIRTY_BATTERY BIT(1)
+#define STATUS_DIRTY_WPM BIT(2)
+#define STATUS_DIRTY_LAYER BIT(3)
 
 struct status_state {
   uint8_t battery;
@@ -23,7 +24,7 @@ struct status_state {
   bool active_profile_bonded;
   uint8_t layer_index;
   const char *layer_label;
-  uint8_t wpm[10];
+  struct wpm_history wpm;
   uint8_t mod_state;
 #else
   bool connected;
@@ -31,10 +32,6 @@ struct status_state {
 };
 
 void to_uppercase(char *str);
-void rotate_canvas(lv_obj_t *canvas, lv_color_t cbuf[]);
 void draw_background(lv_obj_t *canvas);
-void init_rect_dsc(lv_draw_rect_dsc_t *rect_dsc, lv_color_t bg_color);
-void init_line_dsc(lv_draw_line_dsc_t *line_dsc, lv_color_t color,
-                   uint8_t width);
-void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color,
-                    const lv_font_t *font, lv_text_align_t align);
+void restore_background_area(lv_obj_t *canvas, const uint8_t *background,
+                             const lv_area_t *area);
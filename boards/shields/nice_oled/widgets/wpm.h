@@ -7,4 +7,9 @@ struct wpm_status_state {
     uint8_t wpm;
 };
 
+/* Portrait canvas area owned by draw_wpm_status(): gauge, needle and graph */
+#define WPM_STATUS_AREA {.x1 = 0, .y1 = 64, .x2 = CANVAS_WIDTH - 1, .y2 = 130}
+
+// Static art of the area, drawn once into the saved background
+void draw_wpm_background(lv_obj_t *canvas);
 void draw_wpm_status(lv_obj_t *canvas, const struct status_state *state);
\ No newline at end of file
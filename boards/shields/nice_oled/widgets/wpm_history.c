@@ -0,0 +1,51 @@
+#include "wpm_history.h"
+#include <string.h>
+
+static inline uint8_t wrap(int pos) { return pos < WPM_HISTORY_LEN ? pos : pos - WPM_HISTORY_LEN; }
+
+static inline uint8_t deque_back(const struct wpm_deque *deque) {
+    return deque->pos[wrap(deque->front + deque->len - 1)];
+}
+
+static inline void deque_push_back(struct wpm_deque *deque, uint8_t pos) {
+    deque->pos[wrap(deque->front + deque->len)] = pos;
+    deque->len++;
+}
+
+// Drop the front if it is the sample about to leave the window
+static inline void deque_expire(struct wpm_deque *deque, uint8_t pos) {
+    if (deque->len > 0 && deque->pos[deque->front] == pos) {
+        deque->front = wrap(deque->front + 1);
+        deque->len--;
+    }
+}
+
+void wpm_history_init(struct wpm_history *history) {
+    memset(history, 0, sizeof(*history));
+
+    // Only the newest of equal samples is kept, so all zeros is one entry
+    deque_push_back(&history->min, WPM_HISTORY_LEN - 1);
+    deque_push_back(&history->max, WPM_HISTORY_LEN - 1);
+}
+
+void wpm_history_push(struct wpm_history *history, uint8_t value) {
+    uint8_t pos = history->head;
+
+    // The oldest sample is the front of a deque if it is there at all
+    deque_expire(&history->min, pos);
+    deque_expire(&history->max, pos);
+
+    history->samples[pos] = value;
+    history->head = wrap(pos + 1);
+
+    // Older samples that can no longer be the min or max are dropped
+    while (history->min.len > 0 && history->samples[deque_back(&history->min)] >= value) {
+        history->min.len--;
+    }
+    deque_push_back(&history->min, pos);
+
+    while (history->max.len > 0 && history->samples[deque_back(&history->max)] <= value) {
+        history->max.len--;
+    }
+    deque_push_back(&history->max, pos);
+}
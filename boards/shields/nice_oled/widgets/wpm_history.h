@@ -0,0 +1,50 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/*
+ * WPM samples of the last CONFIG_NICE_OLED_WPM_HISTORY_LENGTH updates.
+ *
+ * Samples live in a ring, so adding one is O(1), and two monotonic deques of
+ * ring positions keep the window minimum and maximum up to date as samples
+ * arrive: each deque is ordered by age and strictly increasing (min) or
+ * decreasing (max) in value, so its front is the answer.
+ */
+
+#define WPM_HISTORY_LEN CONFIG_NICE_OLED_WPM_HISTORY_LENGTH
+
+struct wpm_deque {
+    uint8_t pos[WPM_HISTORY_LEN];
+    uint8_t front;
+    uint8_t len;
+};
+
+struct wpm_history {
+    uint8_t samples[WPM_HISTORY_LEN];
+    uint8_t head; // position of the oldest sample
+    struct wpm_deque min;
+    struct wpm_deque max;
+};
+
+// Fill the history with zeros, as if typing had always been idle
+void wpm_history_init(struct wpm_history *history);
+// Replace the oldest sample with value
+void wpm_history_push(struct wpm_history *history, uint8_t value);
+
+// Sample i of the window, 0 being the oldest
+static inline uint8_t wpm_history_get(const struct wpm_history *history, int i) {
+    int pos = history->head + i;
+    return history->samples[pos < WPM_HISTORY_LEN ? pos : pos - WPM_HISTORY_LEN];
+}
+
+static inline uint8_t wpm_history_last(const struct wpm_history *history) {
+    return wpm_history_get(history, WPM_HISTORY_LEN - 1);
+}
+
+static inline uint8_t wpm_history_min(const struct wpm_history *history) {
+    return history->samples[history->min.pos[history->min.front]];
+}
+
+static inline uint8_t wpm_history_max(const struct wpm_history *history) {
+    return history->samples[history->max.pos[history->max.front]];
+}
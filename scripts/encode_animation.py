@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Delta-encode an LVGL 1 bpp animation for widgets/delta_anim.c.
+
+Reads the frames of an LVGL image converter output (LV_IMG_CF_INDEXED_1BIT,
+one <name>_map[] per frame, in order) and writes a C file defining a
+struct delta_anim.
+
+The stream holds frame 0 as a delta against a blank frame, then the delta
+from each frame to the next, and finally the delta from the last frame back
+to frame 0, so playback loops without decoding frame 0 again.
+Each delta is a sequence of runs covering the frame's bitmap bytes:
+
+    0x00-0x3f  n + 1 bytes unchanged
+    0x40-0x7f  the next byte is XORed into n - 0x3f bytes
+    0x80-0xff  n - 0x7f bytes to XOR into the frame follow
+
+Usage: encode_animation.py <images.c> <symbol> > <output.c>
+
+The source frames are kept in scripts/animations/, outside the build, e.g.
+
+    scripts/encode_animation.py scripts/animations/crystal.c crystal_anim \
+        > boards/shields/nice_oled/assets/crystal_anim.c
+"""
+
+import re
+import sys
+
+MAX_SKIP = 64
+MAX_REPEAT = 64
+MAX_LITERAL = 128
+
+
+def read_frames(path):
+    text = open(path).read()
+    frames = []
+    for body in re.findall(r"_map\[\] = \{(.*?)\};", text, re.S):
+        # Skip the palette, which is picked at run time
+        body = body[body.rindex("#endif") + len("#endif"):]
+        frames.append(bytes(int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", body)))
+    sizes = re.findall(r"\.header\.w = (\d+),\s*\.header\.h = (\d+),", text)
+    return frames, [(int(w), int(h)) for w, h in sizes]
+
+
+def run_length(data, i, limit):
+    n = 1
+    while i + n < len(data) and data[i + n] == data[i] and n < limit:
+        n += 1
+    return n
+
+
+def encode_delta(prev, cur):
+    xor = bytes(a ^ b for a, b in zip(prev, cur))
+    out = bytearray()
+    i = 0
+    while i < len(xor):
+        if xor[i] == 0:
+            n = run_length(xor, i, MAX_SKIP)
+            out.append(n - 1)
+        elif run_length(xor, i, MAX_REPEAT) >= 3:
+            n = run_length(xor, i, MAX_REPEAT)
+            out += bytes([0x40 | (n - 1), xor[i]])
+        else:
+            # Stop before unchanged bytes or a repeat worth its own run; a
+            # lone unchanged byte is cheaper inside the literal
+            n = 1
+            while i + n < len(xor) and n < MAX_LITERAL:
+                if xor[i + n] == 0 and (i + n + 1 >= len(xor) or xor[i + n + 1] == 0):
+                    break
+                if xor[i + n] != 0 and run_length(xor, i + n, 3) >= 3:
+                    break
+                n += 1
+            out.append(0x80 | (n - 1))
+            out += xor[i:i + n]
+        i += n
+    return out
+
+
+def main():
+    path, symbol = sys.argv[1], sys.argv[2]
+    frames, sizes = read_frames(path)
+    if len(set(sizes)) != 1 or len(frames) != len(sizes):
+        sys.exit("all frames must have the same size")
+    (w, h), size = sizes[0], len(frames[0])
+    if size != h * ((w + 7) // 8):
+        sys.exit("unexpected bitmap size")
+
+    stream = bytearray(encode_delta(bytes(size), frames[0]))
+    loop = len(stream)
+    for prev, cur in zip(frames, frames[1:] + frames[:1]):
+        stream += encode_delta(prev, cur)
+
+    raw = len(frames) * (size + 8)
+    print("/* Generated by scripts/encode_animation.py from %s, do not edit */" % path)
+    print("/* %d frames of %dx%d, %d bytes instead of %d */" % (len(frames), w, h, len(stream), raw))
+    print()
+    print('#include "../widgets/delta_anim.h"')
+    print()
+    print("static const uint8_t %s_stream[] = {" % symbol)
+    for i in range(0, len(stream), 15):
+        print("    " + " ".join("0x%02x," % b for b in stream[i:i + 15]))
+    print("};")
+    print()
+    print("const struct delta_anim %s = {" % symbol)
+    print("    .w = %d," % w)
+    print("    .h = %d," % h)
+    print("    .frame_count = %d," % len(frames))
+    print("    .loop = %d," % loop)
+    print("    .data = %s_stream," % symbol)
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Run-length encode the 1 bpp images of an LVGL asset file in place.
+
+Rewrites every LV_IMG_CF_INDEXED_1BIT image of the given files as
+RLE_IMG_CF (see widgets/rle_img.h). The palette is kept as it is, including
+its CONFIG_NICE_VIEW_WIDGET_INVERTED variants, and the bitmap bytes that
+follow it are replaced by runs:
+
+    0x00-0x7f  n + 1 literal bytes follow
+    0x80-0xff  the next byte repeated n - 0x7e times
+
+Bitmaps split by #if blocks are encoded one block at a time. Images that
+would not get smaller, and those already encoded, are left alone, so the
+script can be run again after adding new images from the LVGL converter.
+
+Usage: encode_image.py <images.c>...
+"""
+
+import re
+import sys
+
+MAX_LITERAL = 128
+MAX_REPEAT = 129
+BYTES_PER_LINE = 12
+
+HEX = re.compile(r"0x([0-9a-fA-F]{2})")
+MAP = re.compile(r"(uint8_t\s+(\w+)\[\]\s*=\s*\{)(.*?)(\n\};)", re.S)
+DSC = re.compile(r"const lv_img_dsc_t \w+ = \{.*?\};", re.S)
+
+
+def run_length(data, i):
+    n = 1
+    while i + n < len(data) and data[i + n] == data[i] and n < MAX_REPEAT:
+        n += 1
+    return n
+
+
+def encode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        n = run_length(data, i)
+        if n >= 3:
+            out += bytes([0x7e + n, data[i]])
+        else:
+            # Stop the literal where a run worth its own code starts
+            n = 1
+            while i + n < len(data) and n < MAX_LITERAL and run_length(data, i + n) < 3:
+                n += 1
+            out.append(n - 1)
+            out += data[i:i + n]
+        i += n
+    return out
+
+
+def format_bytes(data, indent):
+    return [indent + " ".join("0x%02x," % b for b in data[i:i + BYTES_PER_LINE])
+            for i in range(0, len(data), BYTES_PER_LINE)]
+
+
+def split_palette(lines):
+    """Return the palette lines and the bitmap lines of a map body."""
+    for i, line in enumerate(lines):
+        if line.strip().startswith("#if"):
+            depth = 0
+            for j in range(i, len(lines)):
+                stripped = lines[j].strip()
+                depth += stripped.startswith("#if")
+                depth -= stripped.startswith("#endif")
+                if depth == 0:
+                    return lines[:j + 1], lines[j + 1:]
+        count = len(HEX.findall(line))
+        if count:
+            # Palette without variants: the first two entries
+            seen = 0
+            for j in range(i, len(lines)):
+                seen += len(HEX.findall(lines[j]))
+                if seen >= 8:
+                    return lines[:j + 1], lines[j + 1:]
+    return lines, []
+
+
+def encode_bitmap(lines, sizes):
+    """Encode each run of data lines between preprocessor lines."""
+    out, block = [], []
+
+    def flush():
+        data = bytes(int(b, 16) for line in block for b in HEX.findall(line))
+        if data:
+            indent = re.match(r"\s*", next(l for l in block if HEX.search(l))).group(0)
+            encoded = encode(data)
+            sizes[0] += len(data)
+            sizes[1] += len(encoded)
+            out.extend(format_bytes(encoded, indent))
+        block.clear()
+
+    for line in lines:
+        stripped = line.strip()
+        if stripped.startswith("#") or (not HEX.search(line) and stripped):
+            flush()
+            out.append(line)
+        elif stripped:
+            block.append(line)
+        else:
+            flush()
+            out.append(line)
+    flush()
+    return out
+
+
+def encode_file(path):
+    text = open(path).read()
+    encoded_maps = set()
+    for dsc in DSC.findall(text):
+        data = re.search(r"\.data = (\w+)", dsc).group(1)
+        if "LV_IMG_CF_INDEXED_1BIT" in dsc:
+            encoded_maps.add(data)
+
+    sizes = [0, 0]
+
+    def encode_map(m):
+        if m.group(2) not in encoded_maps:
+            return m.group(0)
+        palette, bitmap = split_palette(m.group(3).split("\n"))
+        before = sizes[:]
+        body = palette + encode_bitmap(bitmap, sizes)
+        if sizes[1] - before[1] >= sizes[0] - before[0]:
+            # Nothing to gain, keep the image raw
+            sizes[1] = before[1] + sizes[0] - before[0]
+            encoded_maps.discard(m.group(2))
+            return m.group(0)
+        return m.group(1) + "\n".join(body) + m.group(4)
+
+    def encode_dsc(m):
+        dsc = m.group(0)
+        data = re.search(r"\.data = (\w+)", dsc).group(1)
+        if data not in encoded_maps:
+            return dsc
+        dsc = dsc.replace("LV_IMG_CF_INDEXED_1BIT", "LV_IMG_CF_USER_ENCODED_0")
+        return re.sub(r"\.data_size = [^,]+,", ".data_size = sizeof(%s)," % data, dsc)
+
+    text = MAP.sub(encode_map, text)
+    text = DSC.sub(encode_dsc, text)
+    if encoded_maps and "encode_image.py" not in text:
+        text = ("/* LV_IMG_CF_USER_ENCODED_0 images are run-length encoded by scripts/encode_image.py,\n * see widgets/rle_img.h */\n\n"
+                + text)
+    open(path, "w").write(text)
+    print("%s: %d images encoded, %d bitmap bytes instead of %d" %
+          (path, len(encoded_maps), sizes[1], sizes[0]), file=sys.stderr)
+
+
+def main():
+    for path in sys.argv[1:]:
+        encode_file(path)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,41 @@
+#!/bin/sh
+#
+# Time keystrokes to HID reports on native_sim with the display off, with
+# the widgets on the system work queue and with them on their own, lower
+# priority queue, and print the percentiles of each. Run from a ZMK west
+# workspace:
+#
+#   tests/bench/latency.sh [path to zmk/app] [shield...]
+#
+set -e
+
+BENCH=$(cd "$(dirname "$0")" && pwd)
+REPO=$(cd "$BENCH/../.." && pwd)
+APP=${1:-zmk/app}
+[ $# -gt 0 ] && shift
+SHIELDS=${*:-nice_oled nice_epaper}
+mkdir -p build
+
+for shield in $SHIELDS; do
+    # As in run.sh, nice_epaper needs the stand-in nice!view header
+    case $shield in
+    nice_epaper) shield_list="nice_view_header_sim nice_epaper" ;;
+    *) shield_list=$shield ;;
+    esac
+
+    echo "== $shield"
+    for config in no_display system_queue dedicated_queue; do
+        build="build/latency-$shield-$config"
+        west build -p -d "$build" -b native_sim "$APP" -- \
+            -DSHIELD="$shield_list" \
+            -DZMK_CONFIG="$BENCH/config" \
+            -DZMK_EXTRA_MODULES="$REPO;$REPO/tests/common;$BENCH" \
+            -DEXTRA_DTC_OVERLAY_FILE="$BENCH/$shield.overlay" \
+            -DEXTRA_CONF_FILE="$BENCH/latency/latency.conf;$BENCH/latency/$config.conf" \
+            ${EXTRA_CMAKE_ARGS} >"$build.log" 2>&1 || {
+            cat "$build.log"
+            exit 1
+        }
+        "$build/zephyr/zephyr.exe" | grep "^key latency"
+    done
+done
@@ -0,0 +1,32 @@
+#!/bin/sh
+#
+# Replay the benchmark session on native_sim for each widget set and print
+# what its frames cost. Run from a ZMK west workspace:
+#
+#   tests/bench/run.sh [path to zmk/app] [shield...]
+#
+set -e
+
+BENCH=$(cd "$(dirname "$0")" && pwd)
+REPO=$(cd "$BENCH/../.." && pwd)
+APP=${1:-zmk/app}
+[ $# -gt 0 ] && shift
+SHIELDS=${*:-nice_oled nice_epaper}
+
+for shield in $SHIELDS; do
+    # The nice_epaper overlay goes on the nice!view header, which native_sim
+    # gets from a stand-in shield listed first
+    case $shield in
+    nice_epaper) shield_list="nice_view_header_sim nice_epaper" ;;
+    *) shield_list=$shield ;;
+    esac
+
+    echo "== $shield"
+    west build -p -d "build/bench-$shield" -b native_sim "$APP" -- \
+        -DSHIELD="$shield_list" \
+        -DZMK_CONFIG="$BENCH/config" \
+        -DZMK_EXTRA_MODULES="$REPO;$REPO/tests/common;$BENCH" \
+        -DEXTRA_DTC_OVERLAY_FILE="$BENCH/$shield.overlay" \
+        ${EXTRA_CMAKE_ARGS}
+    "build/bench-$shield/zephyr/zephyr.exe"
+done
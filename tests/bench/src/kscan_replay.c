@@ -0,0 +1,53 @@
+#define DT_DRV_COMPAT nice_oled_kscan_replay
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/kscan.h>
+
+#include "replay.h"
+
+#define KSCAN_NODE DT_INST(0, DT_DRV_COMPAT)
+#define COLUMNS DT_PROP(KSCAN_NODE, columns)
+
+struct kscan_replay_data {
+    kscan_callback_t callback;
+    bool enabled;
+};
+
+static struct kscan_replay_data kscan_replay_data;
+
+static int kscan_replay_configure(const struct device *dev, kscan_callback_t callback) {
+    ARG_UNUSED(dev);
+
+    kscan_replay_data.callback = callback;
+    return 0;
+}
+
+static int kscan_replay_enable(const struct device *dev) {
+    ARG_UNUSED(dev);
+
+    kscan_replay_data.enabled = true;
+    return 0;
+}
+
+static int kscan_replay_disable(const struct device *dev) {
+    ARG_UNUSED(dev);
+
+    kscan_replay_data.enabled = false;
+    return 0;
+}
+
+static const struct kscan_driver_api kscan_replay_api = {
+    .config = kscan_replay_configure,
+    .enable_callback = kscan_replay_enable,
+    .disable_callback = kscan_replay_disable,
+};
+
+DEVICE_DT_INST_DEFINE(0, NULL, NULL, &kscan_replay_data, NULL, POST_KERNEL,
+                      CONFIG_KSCAN_INIT_PRIORITY, &kscan_replay_api);
+
+void kscan_replay_set(uint32_t position, bool pressed) {
+    if (kscan_replay_data.enabled && kscan_replay_data.callback != NULL) {
+        kscan_replay_data.callback(DEVICE_DT_INST_GET(0), position / COLUMNS, position % COLUMNS,
+                                   pressed);
+    }
+}
@@ -0,0 +1,161 @@
+#include <posix_board_if.h>
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+
+#include <zmk/endpoints.h>
+#include <zmk/hid.h>
+
+#include "render_stats.h"
+#include "replay.h"
+
+/*
+ * Keystroke to HID report latency, on simulated time.
+ *
+ * A timer interrupt presses and releases keys at random gaps, stamping each
+ * one as the key scan interrupt would, and the wrapped
+ * zmk_endpoints_send_report() times it when its keyboard report leaves. So
+ * the delay covers the wait for the system work queue and whatever the
+ * status screen keeps it from, and no event listener order is involved.
+ *
+ * Code takes no simulated time on native_sim, so every status screen frame
+ * busy waits its host CPU time, scaled to the keyboard's CPU, on the thread
+ * that drew it. The display stand-in already sleeps for the bus time of
+ * every byte.
+ */
+
+// Key positions, see config/native_sim.keymap
+#define KEY_A 0
+#define KEY_B 1
+#define KEY_LSHIFT 2
+#define KEY_MO1 5
+
+#define NO_KEY UINT32_MAX
+
+#define GAP_MIN_MS 20
+#define GAP_SPREAD_MS 130
+// Untimed layer changes, for the layer widget to redraw
+#define LAYER_EVERY 16
+
+#define STAMP_COUNT 16
+#define EVENT_COUNT CONFIG_NICE_OLED_BENCH_LATENCY_EVENTS
+
+static const uint32_t keys[] = {KEY_A, KEY_B, KEY_LSHIFT};
+
+// Key scan times of the events whose reports are still to come
+static uint32_t stamps[STAMP_COUNT];
+static atomic_t stamp_head;
+static atomic_t stamp_tail;
+
+static uint32_t latencies[EVENT_COUNT];
+static uint32_t event_count;
+
+static K_SEM_DEFINE(done, 0, 1);
+
+static uint32_t next_random(void) {
+    static uint32_t state = 0x2545f491;
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static void send_key(uint32_t position, bool pressed) {
+    stamps[atomic_get(&stamp_head) % STAMP_COUNT] = k_cycle_get_32();
+    atomic_inc(&stamp_head);
+    kscan_replay_set(position, pressed);
+}
+
+// Runs in the timer interrupt, like a key scan would
+static void inject(struct k_timer *timer) {
+    static uint32_t held = NO_KEY;
+    static uint32_t actions;
+    static bool layer;
+    uint32_t random = next_random();
+
+    if (held != NO_KEY) {
+        send_key(held, false);
+        held = NO_KEY;
+    } else if (++actions % LAYER_EVERY == 0) {
+        // No HID report comes of it, so no stamp either
+        layer = !layer;
+        kscan_replay_set(KEY_MO1, layer);
+    } else {
+        held = keys[random % ARRAY_SIZE(keys)];
+        send_key(held, true);
+    }
+
+    if (event_count < EVENT_COUNT) {
+        k_timer_start(timer, K_MSEC(GAP_MIN_MS + (random >> 8) % GAP_SPREAD_MS), K_NO_WAIT);
+    }
+}
+
+static K_TIMER_DEFINE(inject_timer, inject, NULL);
+
+int __real_zmk_endpoints_send_report(uint16_t usage_page);
+
+int __wrap_zmk_endpoints_send_report(uint16_t usage_page) {
+    int ret = __real_zmk_endpoints_send_report(usage_page);
+    atomic_val_t tail = atomic_get(&stamp_tail);
+
+    if (usage_page != HID_USAGE_KEY || tail == atomic_get(&stamp_head)) {
+        return ret;
+    }
+
+    atomic_inc(&stamp_tail);
+    if (event_count < EVENT_COUNT) {
+        latencies[event_count++] = k_cycle_get_32() - stamps[tail % STAMP_COUNT];
+        if (event_count == EVENT_COUNT) {
+            k_sem_give(&done);
+        }
+    }
+
+    return ret;
+}
+
+// Runs on the display work queue at the end of every status screen render
+static void spend_frame(const struct render_stats_frame *frame) {
+    k_busy_wait((uint64_t)frame->ns * CONFIG_NICE_OLED_BENCH_CPU_SCALE / NSEC_PER_USEC);
+}
+
+static int compare(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static uint32_t percentile_us(uint32_t percent) {
+    uint32_t index = DIV_ROUND_UP(EVENT_COUNT * percent, 100) - 1;
+
+    return k_cyc_to_us_ceil32(latencies[index]);
+}
+
+static const char *config_name(void) {
+    if (!IS_ENABLED(CONFIG_ZMK_DISPLAY)) {
+        return "no display";
+    }
+
+    return IS_ENABLED(CONFIG_ZMK_DISPLAY_WORK_QUEUE_DEDICATED) ? "dedicated display queue"
+                                                                : "system queue";
+}
+
+static void measure(void) {
+    render_stats_set_frame_cb(spend_frame);
+
+    // Let the first full draw of the status screen pass
+    k_sleep(K_SECONDS(3));
+
+    k_timer_start(&inject_timer, K_MSEC(GAP_MIN_MS), K_NO_WAIT);
+    k_sem_take(&done, K_FOREVER);
+    k_timer_stop(&inject_timer);
+
+    qsort(latencies, EVENT_COUNT, sizeof(latencies[0]), compare);
+    printk("\nkey latency, %s: %u events, us: p50 %u, p90 %u, p99 %u, max %u\n", config_name(),
+           EVENT_COUNT, percentile_us(50), percentile_us(90), percentile_us(99),
+           percentile_us(100));
+
+    posix_exit(0);
+}
+
+K_THREAD_DEFINE(bench_latency, 2048, measure, NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, 0);
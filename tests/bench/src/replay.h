@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Press or release the key at position, as the key scan would report it
+void kscan_replay_set(uint32_t position, bool pressed);
+
+// The state of charge the battery reports from its next poll on
+void battery_replay_set(uint8_t level);
@@ -0,0 +1,195 @@
+#include <display_mock.h>
+#include <posix_board_if.h>
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+#include <lvgl_mem.h>
+#endif
+
+#include "render_stats.h"
+#include "replay.h"
+
+/*
+ * A synthetic session, replayed through the key scan and battery stand-ins
+ * once the display is up. Each phase drives one part of the status screen,
+ * and the report gives what its frames cost: CPU time from the render
+ * statistics, pixels and buffer bytes touched, bytes the page or line flush
+ * meant to send, bytes that did reach the display, and the LVGL heap.
+ */
+
+// Key positions, see config/native_sim.keymap
+#define KEY_A 0
+#define KEY_B 1
+#define KEY_LSHIFT 2
+#define KEY_LCTRL 3
+#define KEY_LALT 4
+#define KEY_MO1 5
+
+#define TAP_MS 30
+
+enum phase {
+    PHASE_STARTUP,
+    PHASE_WPM,
+    PHASE_LAYERS,
+    PHASE_MODIFIERS,
+    PHASE_BATTERY,
+    PHASE_COUNT,
+};
+
+static const char *const phase_names[PHASE_COUNT] = {
+    [PHASE_STARTUP] = "startup",     [PHASE_WPM] = "wpm ramp",
+    [PHASE_LAYERS] = "layer flips",  [PHASE_MODIFIERS] = "mod chords",
+    [PHASE_BATTERY] = "battery",
+};
+
+static struct phase_stats {
+    uint32_t frames;
+    uint64_t ns;
+    uint32_t max_ns;
+    uint64_t pixels;
+    uint64_t bytes;
+    uint64_t flushed;
+    uint64_t written;
+    uint32_t writes;
+    size_t heap_max;
+} phases[PHASE_COUNT];
+
+static atomic_t current = ATOMIC_INIT(PHASE_STARTUP);
+
+static const struct device *const display = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+
+// Runs on the display work queue at the end of every status screen render
+static void collect_frame(const struct render_stats_frame *frame) {
+    struct phase_stats *stats = &phases[atomic_get(&current)];
+
+    stats->frames++;
+    stats->ns += frame->ns;
+    stats->max_ns = MAX(stats->max_ns, frame->ns);
+    stats->pixels += frame->pixels;
+    stats->bytes += frame->bytes;
+    stats->flushed += frame->flushed;
+    stats->heap_max = MAX(stats->heap_max, frame->heap_max);
+}
+
+static void end_phase(void) {
+    struct phase_stats *stats = &phases[atomic_get(&current)];
+    struct display_mock_stats written;
+
+    // Let the last render of the phase reach the display
+    k_sleep(K_SECONDS(1));
+
+    display_mock_get_stats(display, &written);
+    stats->written = written.bytes;
+    stats->writes = written.writes;
+    display_mock_reset(display);
+}
+
+static void start_phase(enum phase phase) {
+    end_phase();
+    atomic_set(&current, phase);
+}
+
+static void tap(uint32_t position) {
+    kscan_replay_set(position, true);
+    k_msleep(TAP_MS);
+    kscan_replay_set(position, false);
+}
+
+// From 1 to 10 keys a second, 3 s at each rate, then idle until WPM is 0
+static void ramp_wpm(void) {
+    for (int rate = 1; rate <= 10; rate++) {
+        for (int i = 0; i < rate * 3; i++) {
+            tap(i & 1 ? KEY_B : KEY_A);
+            k_msleep(1000 / rate - TAP_MS);
+        }
+    }
+    k_sleep(K_SECONDS(10));
+}
+
+static void flip_layers(void) {
+    for (int i = 0; i < 20; i++) {
+        kscan_replay_set(KEY_MO1, true);
+        k_msleep(300);
+        tap(KEY_A);
+        k_msleep(300);
+        kscan_replay_set(KEY_MO1, false);
+        k_msleep(300);
+    }
+}
+
+static void press_chords(void) {
+    static const uint32_t chords[][2] = {
+        {KEY_LSHIFT, KEY_LCTRL},
+        {KEY_LSHIFT, KEY_LALT},
+        {KEY_LCTRL, KEY_LALT},
+    };
+
+    for (int i = 0; i < 30; i++) {
+        const uint32_t *chord = chords[i % ARRAY_SIZE(chords)];
+
+        kscan_replay_set(chord[0], true);
+        k_msleep(50);
+        kscan_replay_set(chord[1], true);
+        k_msleep(100);
+        tap(KEY_A);
+        k_msleep(100);
+        kscan_replay_set(chord[1], false);
+        kscan_replay_set(chord[0], false);
+        k_msleep(300);
+    }
+}
+
+// Down to empty in 5 % steps, one per battery poll
+static void drain_battery(void) {
+    for (int level = 95; level >= 0; level -= 5) {
+        battery_replay_set(level);
+        k_msleep(CONFIG_ZMK_BATTERY_REPORTING_INTERVAL * MSEC_PER_SEC + 100);
+    }
+}
+
+static void report(void) {
+    printk("\n%-12s %6s %8s %8s %9s %8s %9s %7s %9s %9s\n", "phase", "frames", "avg us",
+           "max us", "px/frame", "B/frame", "flush/fr", "writes", "written B", "heap max");
+
+    for (int i = 0; i < PHASE_COUNT; i++) {
+        const struct phase_stats *stats = &phases[i];
+        uint32_t frames = MAX(stats->frames, 1);
+
+        printk("%-12s %6u %8u %8u %9u %8u %9u %7u %9u %9u\n", phase_names[i], stats->frames,
+               (uint32_t)(stats->ns / frames / NSEC_PER_USEC), stats->max_ns / NSEC_PER_USEC,
+               (uint32_t)(stats->pixels / frames), (uint32_t)(stats->bytes / frames),
+               (uint32_t)(stats->flushed / frames), stats->writes, (uint32_t)stats->written,
+               (uint32_t)stats->heap_max);
+    }
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP)
+    struct sys_memory_stats heap;
+
+    lvgl_heap_stats(&heap);
+    printk("lvgl heap: %zu allocated, %zu max, %zu free\n", heap.allocated_bytes,
+           heap.max_allocated_bytes, heap.free_bytes);
+#endif
+}
+
+static void session(void) {
+    render_stats_set_frame_cb(collect_frame);
+
+    // Startup covers the first full draw of every part
+    k_sleep(K_SECONDS(3));
+
+    start_phase(PHASE_WPM);
+    ramp_wpm();
+    start_phase(PHASE_LAYERS);
+    flip_layers();
+    start_phase(PHASE_MODIFIERS);
+    press_chords();
+    start_phase(PHASE_BATTERY);
+    drain_battery();
+    end_phase();
+
+    report();
+    posix_exit(0);
+}
+
+K_THREAD_DEFINE(bench_session, 2048, session, NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, 0);
@@ -0,0 +1,277 @@
+#include <bench_time.h>
+#include <lvgl.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+
+#include "canvas.h"
+
+/*
+ * canvas_draw_img() and canvas_draw_text() against what the status screen
+ * did before it drew in panel orientation: the lv_canvas_draw_*() call on a
+ * square true color canvas in portrait, then lv_canvas_transform() by 900
+ * into panel orientation. Both must agree bit for bit on the whole panel.
+ */
+
+#define PORTRAIT_W 68
+#define PORTRAIT_H 160
+#define PALETTE_SIZE (2 * sizeof(lv_color32_t))
+
+#define SRC_MAX 40
+#define SRC_STRIDE(w) (((w) + 7) >> 3)
+
+static uint8_t cbuf[CANVAS_BUF_SIZE(PORTRAIT_H, PORTRAIT_W)];
+static lv_color_t ref_buf[PORTRAIT_H * PORTRAIT_H];
+static lv_color_t ref_tmp[PORTRAIT_H * PORTRAIT_H];
+
+static lv_obj_t *canvas;
+static lv_obj_t *ref;
+
+struct test_img {
+    lv_img_dsc_t dsc;
+    uint8_t data[PALETTE_SIZE + SRC_MAX * SRC_STRIDE(SRC_MAX)];
+};
+
+// Source palettes: index 0 and 1 colors, and whether each is opaque
+static const struct {
+    bool fg[2];
+    bool opaque[2];
+} palettes[] = {
+    {{false, true}, {true, true}},
+    {{false, true}, {false, true}},
+    {{true, false}, {true, true}},
+    {{true, false}, {true, false}},
+};
+
+static const struct {
+    lv_coord_t w;
+    lv_coord_t h;
+} sizes[] = {
+    {8, 8}, {1, 1}, {13, 21}, {7, 30}, {32, 22}, {33, 10}, {20, 3}, {40, 17},
+};
+
+// Unaligned spots, and spots clipped by each edge of the panel
+static const lv_point_t positions[] = {
+    {0, 0},   {3, 5},    {1, 7},    {35, 80}, {-5, 9},  {60, 3},   {20, -6},
+    {30, 150}, {-7, -3}, {64, 155}, {70, 0},  {0, 170}, {-40, 20},
+};
+
+// Pseudo random source pixels, the same on every run
+static uint32_t seed;
+static bool pattern[SRC_MAX][SRC_MAX];
+
+static void make_pattern(lv_coord_t w, lv_coord_t h) {
+    for (lv_coord_t y = 0; y < h; y++) {
+        for (lv_coord_t x = 0; x < w; x++) {
+            seed = seed * 1103515245 + 12345;
+            pattern[y][x] = (seed >> 16) & 1;
+        }
+    }
+}
+
+static void set_palette(lv_color32_t *entry, bool fg, bool opaque) {
+    entry->full = lv_color_to32(fg ? LVGL_FOREGROUND : LVGL_BACKGROUND);
+    entry->ch.alpha = opaque ? LV_OPA_COVER : LV_OPA_TRANSP;
+}
+
+// The w x h pattern turned by rotation quarter turns clockwise
+static void make_img(struct test_img *img, lv_coord_t w, lv_coord_t h, int rotation,
+                     int palette) {
+    lv_coord_t img_w = rotation & 1 ? h : w;
+    lv_coord_t img_h = rotation & 1 ? w : h;
+    uint8_t *bits = img->data + PALETTE_SIZE;
+
+    memset(img->data, 0, sizeof(img->data));
+    for (int i = 0; i < 2; i++) {
+        set_palette(&((lv_color32_t *)img->data)[i], palettes[palette].fg[i],
+                    palettes[palette].opaque[i]);
+    }
+
+    for (lv_coord_t y = 0; y < img_h; y++) {
+        for (lv_coord_t x = 0; x < img_w; x++) {
+            bool set;
+
+            switch (rotation) {
+            case 0:
+                set = pattern[y][x];
+                break;
+            case 1:
+                set = pattern[h - 1 - x][y];
+                break;
+            case 2:
+                set = pattern[h - 1 - y][w - 1 - x];
+                break;
+            default:
+                set = pattern[x][w - 1 - y];
+                break;
+            }
+
+            if (set) {
+                bits[y * SRC_STRIDE(img_w) + (x >> 3)] |= 0x80 >> (x & 7);
+            }
+        }
+    }
+
+    img->dsc = (lv_img_dsc_t){
+        .header.cf = LV_IMG_CF_INDEXED_1BIT,
+        .header.w = img_w,
+        .header.h = img_h,
+        .data_size = PALETTE_SIZE + img_h * SRC_STRIDE(img_w),
+        .data = img->data,
+    };
+}
+
+static void clear_canvas(void) {
+    lv_draw_rect_dsc_t rect_dsc;
+
+    init_rect_dsc(&rect_dsc, LVGL_BACKGROUND);
+    canvas_draw_rect(canvas, 0, 0, PORTRAIT_W, PORTRAIT_H, &rect_dsc);
+}
+
+// The rotation the status screen used to do after drawing, rotate_canvas()
+static void rotate_reference(void) {
+    lv_img_dsc_t img = {
+        .header.cf = LV_IMG_CF_TRUE_COLOR,
+        .header.w = PORTRAIT_H,
+        .header.h = PORTRAIT_H,
+        .data_size = sizeof(ref_tmp),
+        .data = (const uint8_t *)ref_tmp,
+    };
+
+    memcpy(ref_tmp, ref_buf, sizeof(ref_tmp));
+    lv_canvas_fill_bg(ref, LVGL_BACKGROUND, LV_OPA_COVER);
+    lv_canvas_transform(ref, &img, 900, LV_IMG_ZOOM_NONE, -1, 0, PORTRAIT_H / 2, PORTRAIT_H / 2,
+                        false);
+}
+
+static void check_panel(const char *what) {
+    uint8_t fg = lv_color_to1(LVGL_FOREGROUND);
+
+    for (lv_coord_t row = 0; row < PORTRAIT_W; row++) {
+        const uint8_t *bits = cbuf + PALETTE_SIZE + row * SRC_STRIDE(PORTRAIT_H);
+
+        for (lv_coord_t col = 0; col < PORTRAIT_H; col++) {
+            uint8_t index = (bits[col >> 3] >> (7 - (col & 7))) & 1;
+            uint8_t expected = lv_color_to1(lv_canvas_get_px(ref, col, row)) == fg;
+
+            zassert_equal(index, expected, "%s: panel pixel (%d, %d) is %u, expected %u", what,
+                          col, row, index, expected);
+        }
+    }
+}
+
+ZTEST(canvas, test_draw_img) {
+    lv_draw_img_dsc_t dsc;
+    struct test_img img;
+    char what[64];
+
+    lv_draw_img_dsc_init(&dsc);
+
+    for (int s = 0; s < ARRAY_SIZE(sizes); s++) {
+        make_pattern(sizes[s].w, sizes[s].h);
+
+        for (int rotation = 0; rotation < 4; rotation++) {
+            for (int p = 0; p < ARRAY_SIZE(palettes); p++) {
+                make_img(&img, sizes[s].w, sizes[s].h, rotation, p);
+
+                for (int i = 0; i < ARRAY_SIZE(positions); i++) {
+                    lv_coord_t x = positions[i].x;
+                    lv_coord_t y = positions[i].y;
+
+                    clear_canvas();
+                    canvas_draw_img(canvas, x, y, &img.dsc, &dsc);
+
+                    lv_canvas_fill_bg(ref, LVGL_BACKGROUND, LV_OPA_COVER);
+                    lv_canvas_draw_img(ref, x, y, &img.dsc, &dsc);
+                    rotate_reference();
+
+                    snprintf(what, sizeof(what), "%dx%d turned %d, palette %d at (%d, %d)",
+                             sizes[s].w, sizes[s].h, rotation * 90, p, x, y);
+                    check_panel(what);
+                }
+            }
+        }
+    }
+}
+
+// 1 bpp glyphs go through the same blit, packed without row padding
+ZTEST(canvas, test_draw_text) {
+    static const char *const texts[] = {"A", "Wg", "LAYER 1", "100%"};
+    lv_draw_label_dsc_t dsc;
+    char what[64];
+
+    init_label_dsc(&dsc, LVGL_FOREGROUND, &lv_font_unscii_8, LV_TEXT_ALIGN_LEFT);
+
+    for (int t = 0; t < ARRAY_SIZE(texts); t++) {
+        for (int i = 0; i < ARRAY_SIZE(positions); i++) {
+            lv_coord_t x = positions[i].x;
+            lv_coord_t y = positions[i].y;
+
+            clear_canvas();
+            canvas_draw_text(canvas, x, y, PORTRAIT_H, &dsc, texts[t]);
+
+            lv_canvas_fill_bg(ref, LVGL_BACKGROUND, LV_OPA_COVER);
+            lv_canvas_draw_text(ref, x, y, PORTRAIT_H, &dsc, texts[t]);
+            rotate_reference();
+
+            snprintf(what, sizeof(what), "\"%s\" at (%d, %d)", texts[t], x, y);
+            check_panel(what);
+        }
+    }
+}
+
+#define BENCH_RUNS 1000
+
+// Time per call, in ns on native_sim and from the cycle counter elsewhere
+ZTEST(canvas, test_benchmark) {
+    lv_draw_img_dsc_t dsc;
+    struct test_img img;
+    uint64_t start;
+
+    lv_draw_img_dsc_init(&dsc);
+    make_pattern(32, 22);
+    make_img(&img, 32, 22, 0, 0);
+
+    // The size of a Luna frame, at an unaligned spot
+    start = bench_now();
+    for (int i = 0; i < BENCH_RUNS; i++) {
+        canvas_draw_img(canvas, 19, 45, &img.dsc, &dsc);
+    }
+    uint64_t blit = bench_ns_since(start) / BENCH_RUNS;
+
+    start = bench_now();
+    for (int i = 0; i < BENCH_RUNS; i++) {
+        lv_canvas_draw_img(ref, 19, 45, &img.dsc, &dsc);
+    }
+    uint64_t draw = bench_ns_since(start) / BENCH_RUNS;
+
+    // Paid once per frame, however little was drawn
+    start = bench_now();
+    for (int i = 0; i < BENCH_RUNS / 10; i++) {
+        rotate_reference();
+    }
+    uint64_t rotate = bench_ns_since(start) / (BENCH_RUNS / 10);
+
+    TC_PRINT("32x22 image: canvas_draw_img %u ns\n", (uint32_t)blit);
+    TC_PRINT("32x22 image: lv_canvas_draw_img %u ns, then %u ns per frame to rotate\n",
+             (uint32_t)draw, (uint32_t)rotate);
+#if !IS_ENABLED(CONFIG_ARCH_POSIX)
+    TC_PRINT("in cycles at %u Hz: %u vs %u + %u\n", sys_clock_hw_cycles_per_sec(),
+             (uint32_t)k_ns_to_cyc_floor64(blit), (uint32_t)k_ns_to_cyc_floor64(draw),
+             (uint32_t)k_ns_to_cyc_floor64(rotate));
+#endif
+}
+
+static void *canvas_setup(void) {
+    canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, cbuf, PORTRAIT_H, PORTRAIT_W, LV_IMG_CF_INDEXED_1BIT);
+    lv_canvas_set_palette(canvas, 0, LVGL_BACKGROUND);
+    lv_canvas_set_palette(canvas, 1, LVGL_FOREGROUND);
+
+    ref = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(ref, ref_buf, PORTRAIT_H, PORTRAIT_H, LV_IMG_CF_TRUE_COLOR);
+
+    return NULL;
+}
+
+ZTEST_SUITE(canvas, NULL, canvas_setup, NULL, NULL, NULL);
@@ -0,0 +1,186 @@
+#include <display_mock.h>
+#include <lvgl.h>
+#include <zephyr/ztest.h>
+
+#include "canvas.h"
+
+/*
+ * What a tracked canvas sends to the display: the status screen draws,
+ * canvas_flush_pages() invalidates what differs from the last flush, and
+ * LVGL renders that into display_write() calls, recorded by the display
+ * stand-in. Areas are in panel coordinates, rects are drawn in portrait.
+ *
+ * A vtiled stand-in takes SSD1306 pages, tracked by canvas_track_pages().
+ * The shared one, as built without pages.overlay, takes Sharp LS0xx lines,
+ * tracked by canvas_track_lines().
+ */
+
+#define PORTRAIT_W 68
+#define PORTRAIT_H 160
+
+#define PAGES DT_PROP(DT_CHOSEN(zephyr_display), vtiled)
+
+/*
+ * SPI bytes of one display_write() to the Zephyr ls0xx driver: the write
+ * command, then the address, 20 data bytes and a trailer for each line, and
+ * a last trailer, all in one transaction.
+ */
+#define LS0XX_SPI_BYTES(lines) (2 + (lines) * (1 + PORTRAIT_H / 8 + 1))
+
+struct expected_write {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    size_t bytes;
+};
+
+static const struct device *const display = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+
+static uint8_t cbuf[CANVAS_BUF_SIZE(PORTRAIT_H, PORTRAIT_W)];
+static uint8_t shadow[CANVAS_BUF_SIZE(PORTRAIT_H, PORTRAIT_W)];
+static lv_obj_t *canvas;
+
+static void fill(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h, lv_color_t color) {
+    lv_draw_rect_dsc_t dsc;
+
+    init_rect_dsc(&dsc, color);
+    canvas_draw_rect(canvas, x, y, w, h, &dsc);
+}
+
+// Flush what the rects changed and check it arrived as exactly these writes,
+// giving the SPI bytes the ls0xx driver would send for them
+static uint32_t assert_writes(const struct expected_write *expected, uint32_t count) {
+    uint32_t written;
+    uint32_t spi_bytes = 0;
+    const struct display_mock_write *writes;
+
+    display_mock_reset(display);
+    canvas_flush_pages(canvas);
+    lv_refr_now(NULL);
+
+    writes = display_mock_writes(display, &written);
+    zassert_equal(written, count, "%u writes instead of %u", written, count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        zassert_equal(writes[i].x, expected[i].x, "write %u: x %u", i, writes[i].x);
+        zassert_equal(writes[i].y, expected[i].y, "write %u: y %u", i, writes[i].y);
+        zassert_equal(writes[i].width, expected[i].width, "write %u: width %u", i,
+                      writes[i].width);
+        zassert_equal(writes[i].height, expected[i].height, "write %u: height %u", i,
+                      writes[i].height);
+        zassert_equal(writes[i].bytes, expected[i].bytes, "write %u: %zu bytes", i,
+                      writes[i].bytes);
+        spi_bytes += LS0XX_SPI_BYTES(writes[i].height);
+    }
+
+    return spi_bytes;
+}
+
+#if PAGES
+// Portrait rows 16 to 31 are panel columns 128 to 143, two bytes of page 1
+ZTEST(canvas_flush, test_one_page) {
+    static const struct expected_write expected[] = {{128, 8, 16, 8, 16}};
+
+    fill(8, 16, 8, 16, LVGL_FOREGROUND);
+    assert_writes(expected, ARRAY_SIZE(expected));
+}
+
+// Part of a byte still sends the whole byte of every row of the page
+ZTEST(canvas_flush, test_partial_byte) {
+    static const struct expected_write expected[] = {{128, 8, 8, 8, 8}};
+
+    fill(10, 28, 2, 2, LVGL_FOREGROUND);
+    assert_writes(expected, ARRAY_SIZE(expected));
+}
+
+// Pages apart are sent apart, not as the area around both
+ZTEST(canvas_flush, test_two_pages) {
+    static const struct expected_write expected[] = {
+        {0, 0, 8, 8, 8},
+        {152, 40, 8, 8, 8},
+    };
+
+    fill(0, 152, 8, 8, LVGL_FOREGROUND);
+    fill(40, 0, 8, 8, LVGL_FOREGROUND);
+    assert_writes(expected, ARRAY_SIZE(expected));
+}
+
+#else
+// Rows 8 to 15 changed, sent as one run of whole lines
+ZTEST(canvas_flush, test_line_run) {
+    static const struct expected_write expected[] = {{0, 8, 160, 8, 160}};
+
+    fill(8, 16, 8, 16, LVGL_FOREGROUND);
+    zassert_equal(assert_writes(expected, ARRAY_SIZE(expected)), LS0XX_SPI_BYTES(8));
+}
+
+// A single pixel still sends its whole line, and only that
+ZTEST(canvas_flush, test_one_line) {
+    static const struct expected_write expected[] = {{0, 10, 160, 1, 20}};
+
+    fill(10, 28, 1, 1, LVGL_FOREGROUND);
+    zassert_equal(assert_writes(expected, ARRAY_SIZE(expected)), LS0XX_SPI_BYTES(1));
+}
+
+// Runs apart are sent apart, a fraction of the whole panel
+ZTEST(canvas_flush, test_two_runs) {
+    static const struct expected_write expected[] = {
+        {0, 0, 160, 3, 60},
+        {0, 40, 160, 8, 160},
+    };
+    uint32_t spi_bytes;
+
+    fill(0, 152, 3, 8, LVGL_FOREGROUND);
+    fill(40, 0, 8, 8, LVGL_FOREGROUND);
+    spi_bytes = assert_writes(expected, ARRAY_SIZE(expected));
+    zassert_equal(spi_bytes, LS0XX_SPI_BYTES(3) + LS0XX_SPI_BYTES(8));
+    zassert_true(spi_bytes < LS0XX_SPI_BYTES(PORTRAIT_W) / 5, "%u of %u bytes", spi_bytes,
+                 LS0XX_SPI_BYTES(PORTRAIT_W));
+}
+#endif
+
+// The same pixels drawn again send nothing, whatever was redrawn
+ZTEST(canvas_flush, test_same_pixels) {
+    fill(0, 0, PORTRAIT_W, PORTRAIT_H, LVGL_FOREGROUND);
+    canvas_flush_pages(canvas);
+    lv_refr_now(NULL);
+
+    fill(0, 0, PORTRAIT_W, PORTRAIT_H, LVGL_FOREGROUND);
+    fill(20, 40, 30, 50, LVGL_FOREGROUND);
+    assert_writes(NULL, 0);
+
+    // And drawing over a change before the flush leaves nothing to send
+    fill(20, 40, 30, 50, LVGL_BACKGROUND);
+    fill(20, 40, 30, 50, LVGL_FOREGROUND);
+    assert_writes(NULL, 0);
+}
+
+// Start every test from a background canvas that the panel already shows
+static void canvas_flush_before(void *fixture) {
+    ARG_UNUSED(fixture);
+
+    fill(0, 0, PORTRAIT_W, PORTRAIT_H, LVGL_BACKGROUND);
+    canvas_flush_pages(canvas);
+    lv_refr_now(NULL);
+}
+
+static void *canvas_flush_setup(void) {
+    zassert_true(device_is_ready(display), "display mock not ready");
+
+    canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, cbuf, PORTRAIT_H, PORTRAIT_W, LV_IMG_CF_INDEXED_1BIT);
+    lv_canvas_set_palette(canvas, 0, LVGL_BACKGROUND);
+    lv_canvas_set_palette(canvas, 1, LVGL_FOREGROUND);
+
+    if (PAGES) {
+        canvas_track_pages(canvas, shadow);
+    } else {
+        canvas_track_lines(canvas, shadow);
+    }
+    lv_refr_now(NULL);
+
+    return NULL;
+}
+
+ZTEST_SUITE(canvas_flush, NULL, canvas_flush_setup, canvas_flush_before, NULL, NULL);
@@ -0,0 +1,7 @@
+# Shared by the test apps, included before find_package(Zephyr): this
+# module, the 1 bpp LVGL setup of the status screens, and the display
+# stand-in as the only display. Each app's prj.conf and any
+# EXTRA_DTC_OVERLAY_FILE given to the build come on top.
+list(APPEND EXTRA_ZEPHYR_MODULES ${CMAKE_CURRENT_LIST_DIR})
+set(EXTRA_CONF_FILE ${CMAKE_CURRENT_LIST_DIR}/app.conf)
+set(EXTRA_DTC_OVERLAY_FILE ${CMAKE_CURRENT_LIST_DIR}/app.overlay)
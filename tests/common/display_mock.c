@@ -0,0 +1,118 @@
+#define DT_DRV_COMPAT nice_oled_display_mock
+
+#include <display_mock.h>
+#include <string.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/kernel.h>
+
+struct display_mock_config {
+    uint16_t width;
+    uint16_t height;
+    bool vtiled;
+    uint32_t byte_time_ns;
+};
+
+struct display_mock_data {
+    struct display_mock_write writes[DISPLAY_MOCK_MAX_WRITES];
+    struct display_mock_stats stats;
+};
+
+static int display_mock_blanking(const struct device *dev) {
+    ARG_UNUSED(dev);
+    return 0;
+}
+
+static int display_mock_write(const struct device *dev, const uint16_t x, const uint16_t y,
+                              const struct display_buffer_descriptor *desc, const void *buf) {
+    const struct display_mock_config *config = dev->config;
+    struct display_mock_data *data = dev->data;
+    ARG_UNUSED(buf);
+
+    if (data->stats.writes < DISPLAY_MOCK_MAX_WRITES) {
+        data->writes[data->stats.writes] = (struct display_mock_write){
+            .x = x,
+            .y = y,
+            .width = desc->width,
+            .height = desc->height,
+            .bytes = desc->buf_size,
+        };
+    }
+    data->stats.writes++;
+    data->stats.bytes += desc->buf_size;
+
+    // The real drivers block their caller until the transfer is done
+    if (config->byte_time_ns > 0) {
+        k_sleep(K_NSEC((uint64_t)config->byte_time_ns * desc->buf_size));
+    }
+
+    return 0;
+}
+
+static void display_mock_get_capabilities(const struct device *dev,
+                                          struct display_capabilities *caps) {
+    const struct display_mock_config *config = dev->config;
+
+    // Same formats as the ssd1306 and ls0xx drivers
+    memset(caps, 0, sizeof(*caps));
+    caps->x_resolution = config->width;
+    caps->y_resolution = config->height;
+    caps->supported_pixel_formats = config->vtiled ? PIXEL_FORMAT_MONO10 : PIXEL_FORMAT_MONO01;
+    caps->current_pixel_format = caps->supported_pixel_formats;
+    caps->screen_info = config->vtiled ? SCREEN_INFO_MONO_VTILED : SCREEN_INFO_X_ALIGNMENT_WIDTH;
+    caps->current_orientation = DISPLAY_ORIENTATION_NORMAL;
+}
+
+static int display_mock_set_pixel_format(const struct device *dev,
+                                         const enum display_pixel_format format) {
+    struct display_capabilities caps;
+
+    display_mock_get_capabilities(dev, &caps);
+    return format == caps.current_pixel_format ? 0 : -ENOTSUP;
+}
+
+static int display_mock_set_orientation(const struct device *dev,
+                                        const enum display_orientation orientation) {
+    ARG_UNUSED(dev);
+    return orientation == DISPLAY_ORIENTATION_NORMAL ? 0 : -ENOTSUP;
+}
+
+static const struct display_driver_api display_mock_api = {
+    .blanking_on = display_mock_blanking,
+    .blanking_off = display_mock_blanking,
+    .write = display_mock_write,
+    .get_capabilities = display_mock_get_capabilities,
+    .set_pixel_format = display_mock_set_pixel_format,
+    .set_orientation = display_mock_set_orientation,
+};
+
+const struct display_mock_write *display_mock_writes(const struct device *dev, uint32_t *count) {
+    struct display_mock_data *data = dev->data;
+
+    *count = MIN(data->stats.writes, DISPLAY_MOCK_MAX_WRITES);
+    return data->writes;
+}
+
+void display_mock_get_stats(const struct device *dev, struct display_mock_stats *stats) {
+    const struct display_mock_data *data = dev->data;
+
+    *stats = data->stats;
+}
+
+void display_mock_reset(const struct device *dev) {
+    struct display_mock_data *data = dev->data;
+
+    memset(data, 0, sizeof(*data));
+}
+
+#define DISPLAY_MOCK_DEFINE(n)                                                                     \
+    static const struct display_mock_config display_mock_config_##n = {                            \
+        .width = DT_INST_PROP(n, width),                                                           \
+        .height = DT_INST_PROP(n, height),                                                         \
+        .vtiled = DT_INST_PROP(n, vtiled),                                                         \
+        .byte_time_ns = DT_INST_PROP(n, byte_time_ns),                                             \
+    };                                                                                             \
+    static struct display_mock_data display_mock_data_##n;                                         \
+    DEVICE_DT_INST_DEFINE(n, NULL, NULL, &display_mock_data_##n, &display_mock_config_##n,         \
+                          POST_KERNEL, CONFIG_DISPLAY_INIT_PRIORITY, &display_mock_api);
+
+DT_INST_FOREACH_STATUS_OKAY(DISPLAY_MOCK_DEFINE)
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/*
+ * Elapsed time for the benchmarks. Code takes no simulated time on
+ * native_sim, so there the host clock is read, which needs
+ * CONFIG_EXTERNAL_LIBC. Elsewhere it is the hardware cycle counter.
+ */
+
+#if IS_ENABLED(CONFIG_ARCH_POSIX) && IS_ENABLED(CONFIG_EXTERNAL_LIBC)
+#include <time.h>
+
+static inline uint64_t bench_now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+}
+
+static inline uint64_t bench_ns_since(uint64_t start) { return bench_now() - start; }
+#else
+static inline uint64_t bench_now(void) { return k_cycle_get_32(); }
+
+static inline uint64_t bench_ns_since(uint64_t start) {
+    return k_cyc_to_ns_floor64((uint32_t)(k_cycle_get_32() - (uint32_t)start));
+}
+#endif
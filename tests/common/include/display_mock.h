@@ -0,0 +1,30 @@
+#pragma once
+
+#include <zephyr/device.h>
+
+/*
+ * Display stand-in for the tests and benchmarks, see
+ * dts/bindings/display/nice-oled,display-mock.yaml. It records every
+ * display_write(): the first DISPLAY_MOCK_MAX_WRITES areas, and the count
+ * and bytes of all of them.
+ */
+
+#define DISPLAY_MOCK_MAX_WRITES 32
+
+struct display_mock_write {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    size_t bytes;
+};
+
+struct display_mock_stats {
+    uint32_t writes;
+    uint64_t bytes;
+};
+
+// The writes since the last reset, of which *count are kept
+const struct display_mock_write *display_mock_writes(const struct device *dev, uint32_t *count);
+void display_mock_get_stats(const struct device *dev, struct display_mock_stats *stats);
+void display_mock_reset(const struct device *dev);
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/shell/shell_dummy.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include "render_stats.h"
+
+LOG_MODULE_REGISTER(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+static struct render_stats_frame last;
+static int frames;
+
+static void collect_frame(const struct render_stats_frame *frame) {
+    last = *frame;
+    frames++;
+}
+
+// Work that takes host time, which native_sim does not simulate
+static void spin(void) {
+    for (volatile uint32_t i = 0; i < 100000; i++) {
+    }
+}
+
+ZTEST(render_stats, test_frame) {
+    // 8 x 8 pixels across two bytes of each row, drawn twice
+    const lv_area_t drawn = {.x1 = 3, .y1 = 0, .x2 = 10, .y2 = 7};
+    // Two bytes of columns in one page
+    const lv_area_t flushed = {.x1 = 0, .y1 = 8, .x2 = 15, .y2 = 15};
+
+    frames = 0;
+    render_stats_frame_begin();
+    render_stats_add_area(&drawn);
+    render_stats_add_area(&drawn);
+    render_stats_add_flush(&flushed);
+    RENDER_STATS_MEASURE(RENDER_STATS_WPM, spin());
+    render_stats_frame_end();
+
+    zassert_equal(frames, 1);
+    zassert_equal(last.pixels, 128);
+    zassert_equal(last.bytes, 32);
+    zassert_equal(last.flushed, 16);
+    zassert_true(last.ns > 0, "the frame took no time");
+    zassert_true(last.heap_max > 0, "no LVGL heap use seen");
+
+    // Nothing carries over into the next frame
+    render_stats_frame_begin();
+    render_stats_frame_end();
+
+    zassert_equal(frames, 2);
+    zassert_equal(last.pixels, 0);
+    zassert_equal(last.bytes, 0);
+    zassert_equal(last.flushed, 0);
+}
+
+ZTEST(render_stats, test_measure_block) {
+    char expected[32];
+    size_t size;
+
+    // A block counts as one call, whatever it does inside
+    for (int i = 0; i < 3; i++) {
+        RENDER_STATS_MEASURE(RENDER_STATS_LAYER, {
+            spin();
+            spin();
+        });
+    }
+
+    const struct shell *sh = shell_backend_dummy_get_ptr();
+
+    shell_backend_dummy_clear_output(sh);
+    zassert_ok(shell_execute_cmd(sh, "nice_oled stats"));
+
+    const char *output = shell_backend_dummy_get_output(sh, &size);
+
+    snprintf(expected, sizeof(expected), "%-10s %8u", "layer", 3);
+    zassert_not_null(strstr(output, expected), "no \"%s\" in:\n%s", expected, output);
+    if (IS_ENABLED(CONFIG_EXTERNAL_LIBC)) {
+        zassert_not_null(strstr(output, "cycles at 1000000000 Hz"), "not host ns:\n%s", output);
+    }
+}
+
+static void *render_stats_setup(void) {
+    const struct shell *sh = shell_backend_dummy_get_ptr();
+
+    WAIT_FOR(shell_ready(sh), 20000, k_msleep(1));
+    zassert_true(shell_ready(sh), "timed out waiting for the dummy shell");
+
+    render_stats_set_frame_cb(collect_frame);
+    return NULL;
+}
+
+ZTEST_SUITE(render_stats, NULL, render_stats_setup, NULL, NULL, NULL);
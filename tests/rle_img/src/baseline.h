@@ -0,0 +1,372 @@
+/*
+ * The bitmaps of the encoded assets as the LVGL image converter wrote them,
+ * before scripts/encode_image.py, without their palette. Taken from the
+ * asset files of commit 2ee1c25. The Luna frames have no
+ * CONFIG_NICE_OLED_WIDGET_LUNA_VERTICAL_READ variant here: no Kconfig file
+ * defines that symbol, so it is never built.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// 67 x 33
+static const uint8_t grid_raw[] = {
+    0xaa, 0x95, 0x52, 0xaa, 0x55, 0x4a, 0xa9, 0x55, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08,
+    0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08,
+    0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xaa, 0x95, 0x52, 0xaa, 0x55, 0x4a, 0xa9, 0x55, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x02,
+    0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x02,
+    0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x95, 0x52, 0xaa, 0x55, 0x4a,
+    0xa9, 0x55, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08,
+    0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08,
+    0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0x95, 0x52, 0xaa, 0x55, 0x4a, 0xa9, 0x55, 0x20,
+};
+
+// 140 x 68
+static const uint8_t vim_raw[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa4, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x52, 0x7f, 0xff, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xa9, 0x3f, 0xfe, 0x60,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe5, 0x54, 0x9f, 0xfe, 0xd0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0a, 0xaa, 0x40, 0x00, 0xe0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f,
+    0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
+    0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xf4, 0x00, 0x2a, 0xaa, 0xaa, 0x80,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95,
+    0xfa, 0x00, 0x07, 0xff, 0xff, 0xc0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xfd, 0x00, 0x03, 0xff, 0xff, 0xc0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x75,
+    0x7e, 0x80, 0x01, 0xff, 0xff, 0xe0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0xce, 0xbf, 0x40, 0x00, 0xd5, 0x54, 0xd0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xc3,
+    0xdf, 0xa0, 0x00, 0x6a, 0xaa, 0xe0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0xc0, 0x7d, 0xd0, 0x00, 0x35, 0x55, 0x7f,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xc0,
+    0x0c, 0xe8, 0x00, 0x1a, 0xaa, 0xbf, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xea, 0xc0, 0x00, 0xf4, 0x00, 0x0d, 0x55, 0x54,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xed, 0xdc,
+    0x00, 0xfa, 0x00, 0x06, 0xaa, 0xaa, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0xef, 0x80, 0xed, 0x00, 0x03, 0x55, 0x55,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xef, 0x55,
+    0xf0, 0xe2, 0x80, 0x01, 0xaa, 0xaa, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xe7, 0xea, 0xbc, 0xe1, 0x40, 0x00, 0xd5, 0x54,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xdd,
+    0x57, 0x61, 0xa0, 0x00, 0x6a, 0xa9, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0xc3, 0xaa, 0xf9, 0xd0, 0x00, 0x35, 0x52,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xc0,
+    0x77, 0xaf, 0xe8, 0x00, 0x1a, 0xa4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x1d, 0x55, 0xf4, 0x00, 0x0d, 0x7f,
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x60,
+    0x01, 0xaa, 0xfa, 0x00, 0x06, 0xe0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x01, 0x55, 0x7d, 0x00, 0x03, 0xd0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0xc1, 0xaa, 0xbe, 0x80, 0x01, 0xe0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0xe1, 0x55, 0x5f, 0x40, 0x00, 0xc0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x73,
+    0x71, 0xaa, 0xaf, 0xa0, 0x00, 0x40, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xcf, 0xb3, 0x55, 0x57, 0xd0, 0x00, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc1,
+    0xf2, 0xaa, 0xab, 0xe8, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x33, 0x55, 0x55, 0xf4, 0x00, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0,
+    0x01, 0xaa, 0xaa, 0xfa, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xd8, 0x01, 0x55, 0x55, 0x7d, 0x00, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f,
+    0x01, 0xaa, 0xaa, 0xbe, 0x80, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xe1, 0x55, 0x55, 0x5f, 0x40, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0x31, 0xaa, 0xaa, 0xaf, 0xa0, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x33, 0xd5, 0x55, 0x57, 0xd0, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xce,
+    0x32, 0xea, 0xaa, 0xa7, 0xe8, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xc1, 0xf2, 0x75, 0x55, 0x49, 0xf4, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0,
+    0x31, 0x3a, 0xaa, 0x90, 0xfa, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x01, 0x1d, 0x55, 0x26, 0x7d, 0x00,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xd8,
+    0x01, 0x4e, 0xaa, 0x4f, 0x3e, 0x80, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x6f, 0x01, 0x67, 0x54, 0x9f, 0x9f, 0x40,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0xe1, 0x73, 0xa9, 0x3f, 0xcf, 0xa0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3e, 0x79, 0xd2, 0x7f, 0xe7, 0xd0,
+    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xfc, 0xe4, 0xff, 0xf3, 0xe8, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x69, 0xff, 0xf9, 0xf4,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x33, 0xff, 0xfc, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xfe, 0x00,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+};
+
+// 140 x 68
+static const uint8_t vip_marcos_raw[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe7, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xf7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe7, 0xff, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xf7, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0x1f, 0x3f, 0xff, 0xff,
+    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe1, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe7, 0x03, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe7, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf1, 0xf0, 0x7f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xf0, 0x7f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x07, 0x3f, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe7, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe7, 0xff, 0x3f, 0xff, 0xff,
+    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xf1, 0xf8, 0xff, 0xff, 0xff, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff,
+    0xff, 0xfc, 0x03, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xf3, 0x83, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe7, 0xdb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x03, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe6, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe6, 0x49, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe2, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xc7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe7, 0xfb, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x00, 0x02, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe7, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x03, 0x77, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe7, 0xfd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x11, 0xff, 0xff, 0xf0,
+    0x3f, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xf0, 0x1d, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0x00, 0x01, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xfe,
+    0xaf, 0xe0, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xf8, 0x01, 0xff, 0xff, 0xfe, 0xa7, 0xcb, 0x7e, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf3, 0xfb, 0xff, 0xff, 0xfe,
+    0xa3, 0x8b, 0xfe, 0xfe, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe7, 0xf9, 0xff, 0xff, 0xfe, 0xa9, 0xab, 0xfe, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe7, 0x39, 0xff, 0xff, 0xff,
+    0xf8, 0x3f, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe6, 0x19, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0x7f, 0x81, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe6, 0x19, 0xff, 0xff, 0xfe,
+    0xaa, 0x2b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe6, 0x19, 0xff, 0xff, 0xfe, 0xa8, 0x8b, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xf2,
+    0xa1, 0xcb, 0x7c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xf9, 0xe3, 0xff, 0xff, 0xfc, 0x0f, 0xe0, 0x7c, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x79, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x79, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe6, 0x19, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x33, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe6, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe6, 0x19, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf3, 0xf3, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf7, 0x33, 0xff, 0xff, 0xff,
+    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe6, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe6, 0xf9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe6, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe7, 0xd9, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xe7, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf3, 0x9b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xf8, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfc, 0x77, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+};
+
+// 24 x 32
+static const uint8_t dog_sit1_90_raw[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x02, 0x10, 0x00,
+    0x04, 0x08, 0x00, 0x0c, 0x68, 0x00, 0x10, 0x10, 0x00, 0x10, 0x08, 0x00,
+    0x20, 0x04, 0x00, 0x20, 0x03, 0x00, 0x20, 0x00, 0xe0, 0x28, 0x00, 0x1c,
+    0x3e, 0x00, 0x02, 0x1c, 0x00, 0x05, 0x20, 0x00, 0x02, 0x20, 0x00, 0x24,
+    0x3e, 0x00, 0x04, 0x0f, 0x02, 0x04, 0x11, 0x06, 0x02, 0x1f, 0x82, 0xa9,
+    0x00, 0x7c, 0x1e, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 x 32
+static const uint8_t dog_sit2_90_raw[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x01, 0x90, 0x00, 0x02, 0x08, 0x00,
+    0x04, 0x18, 0x00, 0x0c, 0x60, 0x00, 0x10, 0x10, 0x00, 0x10, 0x08, 0x00,
+    0x20, 0x04, 0x00, 0x20, 0x03, 0x00, 0x20, 0x00, 0xe0, 0x28, 0x00, 0x1c,
+    0x3e, 0x00, 0x02, 0x1c, 0x00, 0x05, 0x20, 0x00, 0x02, 0x20, 0x00, 0x24,
+    0x3e, 0x00, 0x04, 0x0f, 0x02, 0x04, 0x11, 0x0e, 0x02, 0x1f, 0x82, 0xa9,
+    0x00, 0x7c, 0x1e, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 x 32
+static const uint8_t dog_walk1_90_raw[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x08, 0x40, 0x03, 0xfc, 0x20,
+    0x1c, 0x01, 0x10, 0x20, 0x00, 0x90, 0x20, 0x00, 0x90, 0x3c, 0x00, 0x90,
+    0x0f, 0x00, 0xa0, 0x11, 0x80, 0xc0, 0x1f, 0x00, 0x80, 0x03, 0x00, 0x80,
+    0x06, 0x01, 0x80, 0x18, 0x00, 0x70, 0x20, 0x00, 0x08, 0x20, 0x00, 0x14,
+    0x3c, 0x00, 0x08, 0x0c, 0x00, 0x90, 0x12, 0x00, 0x10, 0x1e, 0x08, 0x10,
+    0x01, 0x18, 0x08, 0x00, 0xea, 0xa4, 0x00, 0x10, 0x78, 0x00, 0x0f, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 x 32
+static const uint8_t dog_walk2_90_raw[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x20, 0x80, 0x3f, 0xf8, 0x40,
+    0x20, 0x02, 0x20, 0x30, 0x01, 0x20, 0x0c, 0x01, 0x20, 0x02, 0x01, 0x40,
+    0x05, 0x01, 0x80, 0x09, 0x01, 0x00, 0x12, 0x01, 0x00, 0x1e, 0x01, 0x00,
+    0x02, 0x03, 0x00, 0x1c, 0x00, 0xe0, 0x14, 0x00, 0x10, 0x08, 0x00, 0x28,
+    0x10, 0x00, 0x10, 0x20, 0x01, 0x20, 0x2c, 0x00, 0x20, 0x32, 0x10, 0x20,
+    0x01, 0x30, 0x10, 0x00, 0xd5, 0x48, 0x00, 0x20, 0xf0, 0x00, 0x1f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 x 32
+static const uint8_t dog_run1_90_raw[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xe0, 0x0e, 0x02, 0x10, 0x09, 0xc4, 0x08, 0x04, 0xa4, 0x08,
+    0x04, 0xfc, 0xc8, 0x04, 0x00, 0xb0, 0x04, 0x00, 0x80, 0x02, 0x00, 0x80,
+    0x03, 0x00, 0x80, 0x02, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0x02, 0x00, 0x40, 0x04, 0x00, 0x40, 0x08, 0x00, 0x3c,
+    0x10, 0x00, 0x14, 0x26, 0x00, 0x04, 0x2b, 0x00, 0x08, 0x32, 0x80, 0x90,
+    0x04, 0xc8, 0x18, 0x05, 0x58, 0x04, 0x06, 0x28, 0x08, 0x00, 0x2a, 0xb0,
+    0x00, 0x10, 0x40, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 x 32
+static const uint8_t dog_run2_90_raw[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0,
+    0x00, 0x04, 0x10, 0x00, 0x08, 0x10, 0x00, 0x10, 0xf0, 0x00, 0x11, 0x00,
+    0x00, 0xf9, 0x00, 0x01, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0c, 0x01, 0x00,
+    0x10, 0x01, 0x00, 0x20, 0x01, 0x00, 0x28, 0x01, 0x00, 0x37, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0x1e, 0x00, 0x80, 0x20, 0x00, 0x78, 0x20, 0x00, 0x28,
+    0x18, 0x00, 0x08, 0x0c, 0x00, 0x10, 0x14, 0x00, 0x20, 0x1e, 0x01, 0x30,
+    0x01, 0x10, 0x08, 0x00, 0xb0, 0x10, 0x00, 0x50, 0x20, 0x00, 0x55, 0x40,
+    0x00, 0x20, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 x 32
+static const uint8_t dog_bark1_90_raw[] = {
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x04, 0x20, 0x00, 0x08, 0x10,
+    0x00, 0x10, 0xd0, 0x00, 0x11, 0x30, 0x00, 0xf9, 0x00, 0x01, 0x01, 0x00,
+    0x02, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x01, 0x00,
+    0x28, 0x01, 0x00, 0x37, 0x00, 0x80, 0x02, 0x00, 0x80, 0x02, 0x00, 0x40,
+    0x04, 0x00, 0x3c, 0x08, 0x00, 0x14, 0x10, 0x00, 0x04, 0x26, 0x00, 0x08,
+    0x2b, 0x80, 0x90, 0x32, 0xc8, 0x18, 0x04, 0x48, 0x04, 0x05, 0x28, 0x08,
+    0x06, 0x2a, 0xb0, 0x00, 0x10, 0x40, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 x 32
+static const uint8_t dog_bark2_90_raw[] = {
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x04, 0x10, 0x00, 0x08, 0x10,
+    0x00, 0x10, 0xf0, 0x00, 0x11, 0x00, 0x00, 0xf9, 0x00, 0x01, 0x01, 0x00,
+    0x02, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x10, 0x01, 0x00, 0x20, 0x01, 0x00,
+    0x28, 0x01, 0x00, 0x37, 0x00, 0x80, 0x02, 0x00, 0x80, 0x02, 0x00, 0x40,
+    0x04, 0x00, 0x40, 0x08, 0x00, 0x2c, 0x10, 0x00, 0x14, 0x26, 0x00, 0x04,
+    0x2b, 0x00, 0x08, 0x32, 0x80, 0x90, 0x04, 0xc0, 0x18, 0x05, 0x48, 0x04,
+    0x06, 0x28, 0x08, 0x00, 0x2a, 0xb0, 0x00, 0x10, 0x40, 0x00, 0x0f, 0x80,
+    0x00, 0x20, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00,
+};
+
+// 24 x 32
+static const uint8_t dog_sneak1_90_raw[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1e, 0x00, 0x00, 0x21, 0x00, 0x03, 0xf0, 0x80, 0x1c, 0x04, 0x40,
+    0x20, 0x02, 0x40, 0x20, 0x02, 0x40, 0x3c, 0x02, 0x40, 0x0f, 0x02, 0x80,
+    0x11, 0x03, 0x00, 0x1f, 0x02, 0x00, 0x02, 0x02, 0x00, 0x06, 0x04, 0x00,
+    0x18, 0x04, 0x00, 0x20, 0x04, 0x00, 0x20, 0x03, 0xc0, 0x38, 0x01, 0x40,
+    0x08, 0x00, 0x40, 0x10, 0x00, 0x80, 0x18, 0x09, 0x00, 0x04, 0x01, 0x80,
+    0x04, 0x80, 0x40, 0x02, 0x80, 0x80, 0x02, 0xab, 0x00, 0x01, 0x04, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 x 32
+static const uint8_t dog_sneak2_90_raw[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3e, 0x00, 0x00, 0x41, 0x00, 0x3f, 0xf0, 0x80, 0x20, 0x04, 0x40,
+    0x30, 0x02, 0x40, 0x0c, 0x02, 0x40, 0x02, 0x02, 0x80, 0x05, 0x03, 0x00,
+    0x09, 0x02, 0x00, 0x12, 0x02, 0x00, 0x1e, 0x02, 0x00, 0x04, 0x04, 0x00,
+    0x18, 0x04, 0x00, 0x10, 0x02, 0x00, 0x08, 0x01, 0xe0, 0x10, 0x00, 0xa0,
+    0x20, 0x00, 0x20, 0x28, 0x00, 0x40, 0x34, 0x04, 0x80, 0x06, 0x00, 0xc0,
+    0x02, 0x40, 0x20, 0x01, 0x40, 0x40, 0x01, 0x55, 0x80, 0x00, 0x82, 0x00,
+    0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
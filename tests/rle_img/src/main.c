@@ -0,0 +1,225 @@
+#include <lvgl.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+
+#include "baseline.h"
+#include "rle_img.h"
+
+/*
+ * Every run-length encoded asset against its bitmap from before
+ * scripts/encode_image.py, through rle_img_read() and through the image
+ * decoder that lv_img uses.
+ */
+
+#define STRIDE(img) (((img)->header.w + 7) >> 3)
+#define MAX_SIZE 1224
+#define PAD 16
+
+LV_IMG_DECLARE(grid);
+LV_IMG_DECLARE(vim);
+LV_IMG_DECLARE(vip_marcos);
+LV_IMG_DECLARE(dog_sit1_90);
+LV_IMG_DECLARE(dog_sit2_90);
+LV_IMG_DECLARE(dog_walk1_90);
+LV_IMG_DECLARE(dog_walk2_90);
+LV_IMG_DECLARE(dog_run1_90);
+LV_IMG_DECLARE(dog_run2_90);
+LV_IMG_DECLARE(dog_bark1_90);
+LV_IMG_DECLARE(dog_bark2_90);
+LV_IMG_DECLARE(dog_sneak1_90);
+LV_IMG_DECLARE(dog_sneak2_90);
+
+#define ASSET(name) {#name, &name, name##_raw, sizeof(name##_raw)}
+
+static const struct asset {
+    const char *name;
+    const lv_img_dsc_t *img;
+    const uint8_t *raw;
+    size_t size;
+} assets[] = {
+    ASSET(grid),
+    ASSET(vim),
+    ASSET(vip_marcos),
+    ASSET(dog_sit1_90),
+    ASSET(dog_sit2_90),
+    ASSET(dog_walk1_90),
+    ASSET(dog_walk2_90),
+    ASSET(dog_run1_90),
+    ASSET(dog_run2_90),
+    ASSET(dog_bark1_90),
+    ASSET(dog_bark2_90),
+    ASSET(dog_sneak1_90),
+    ASSET(dog_sneak2_90),
+};
+
+static uint8_t buf[MAX_SIZE + PAD];
+
+ZTEST(rle_img, test_assets) {
+    struct rle_img_reader reader;
+
+    for (int i = 0; i < ARRAY_SIZE(assets); i++) {
+        const struct asset *asset = &assets[i];
+        uint32_t stride = STRIDE(asset->img);
+
+        zassert_equal(asset->img->header.cf, RLE_IMG_CF, "%s is not encoded", asset->name);
+        zassert_equal(asset->size, stride * asset->img->header.h, "%s: baseline is %zu bytes",
+                      asset->name, asset->size);
+        zassert_true(asset->size <= MAX_SIZE);
+
+        // In one go, using up the data exactly
+        rle_img_reader_init(&reader, asset->img);
+        rle_img_read(&reader, buf, asset->size);
+        zassert_mem_equal(buf, asset->raw, asset->size, "%s differs", asset->name);
+        zassert_equal_ptr(reader.in, reader.end, "%s: data left over", asset->name);
+        zassert_equal(reader.count, 0, "%s: run left over", asset->name);
+
+        // A row at a time, like canvas_draw_img() does
+        rle_img_reader_init(&reader, asset->img);
+        for (lv_coord_t y = 0; y < asset->img->header.h; y++) {
+            rle_img_read(&reader, buf, stride);
+            zassert_mem_equal(buf, asset->raw + y * stride, stride, "%s: row %d differs",
+                              asset->name, y);
+        }
+    }
+}
+
+ZTEST(rle_img, test_skip) {
+    struct rle_img_reader reader;
+
+    for (int i = 0; i < ARRAY_SIZE(assets); i++) {
+        const struct asset *asset = &assets[i];
+
+        // Skips ending at the start, the middle and the end of runs
+        for (uint32_t skip = 0; skip <= asset->size; skip++) {
+            rle_img_reader_init(&reader, asset->img);
+            rle_img_read(&reader, NULL, skip);
+            rle_img_read(&reader, buf, asset->size - skip);
+            zassert_mem_equal(buf, asset->raw + skip, asset->size - skip,
+                              "%s differs after skipping %u", asset->name, skip);
+        }
+
+        // Every other byte read, every other skipped
+        rle_img_reader_init(&reader, asset->img);
+        for (uint32_t j = 0; j < asset->size; j++) {
+            rle_img_read(&reader, j & 1 ? NULL : buf, 1);
+            if (!(j & 1)) {
+                zassert_equal(buf[0], asset->raw[j], "%s: byte %u differs", asset->name, j);
+            }
+        }
+    }
+}
+
+static void assert_zero(const uint8_t *data, size_t len, const char *what, const char *name) {
+    for (size_t i = 0; i < len; i++) {
+        zassert_equal(data[i], 0, "%s: %s byte %zu is 0x%02x", name, what, i, data[i]);
+    }
+}
+
+// Past the end of the data, everything reads as 0
+ZTEST(rle_img, test_read_past_end) {
+    struct rle_img_reader reader;
+
+    for (int i = 0; i < ARRAY_SIZE(assets); i++) {
+        const struct asset *asset = &assets[i];
+
+        memset(buf, 0xa5, sizeof(buf));
+        rle_img_reader_init(&reader, asset->img);
+        rle_img_read(&reader, buf, asset->size + PAD);
+        zassert_mem_equal(buf, asset->raw, asset->size, "%s differs", asset->name);
+        assert_zero(buf + asset->size, PAD, "padding", asset->name);
+
+        memset(buf, 0xa5, PAD);
+        rle_img_read(&reader, buf, PAD);
+        assert_zero(buf, PAD, "next read", asset->name);
+
+        // A skip running over the end leaves the reader there
+        memset(buf, 0xa5, PAD);
+        rle_img_reader_init(&reader, asset->img);
+        rle_img_read(&reader, NULL, asset->size + PAD);
+        rle_img_read(&reader, buf, PAD);
+        assert_zero(buf, PAD, "read after the skip", asset->name);
+        zassert_equal_ptr(reader.in, reader.end, "%s: reader moved past the data",
+                          asset->name);
+    }
+}
+
+// The longest codes, and one read split across them
+ZTEST(rle_img, test_code_limits) {
+    static uint8_t data[2 * sizeof(lv_color32_t) + 1 + 128 + 2 + 2];
+    static uint8_t expected[128 + 129 + 2];
+    uint8_t *in = data + 2 * sizeof(lv_color32_t);
+    struct rle_img_reader reader;
+    lv_img_dsc_t img = {
+        .header.cf = RLE_IMG_CF,
+        .data_size = sizeof(data),
+        .data = data,
+    };
+
+    *in++ = 0x7f;
+    for (int i = 0; i < 128; i++) {
+        *in++ = expected[i] = i * 7;
+    }
+    *in++ = 0xff;
+    *in++ = 0x3c;
+    memset(expected + 128, 0x3c, 129);
+    *in++ = 0x80;
+    *in++ = 0xc3;
+    memset(expected + 128 + 129, 0xc3, 2);
+
+    rle_img_reader_init(&reader, &img);
+    rle_img_read(&reader, buf, sizeof(expected));
+    zassert_mem_equal(buf, expected, sizeof(expected));
+    zassert_equal_ptr(reader.in, reader.end);
+
+    rle_img_reader_init(&reader, &img);
+    rle_img_read(&reader, buf, 100);
+    rle_img_read(&reader, buf + 100, 100);
+    rle_img_read(&reader, buf + 200, sizeof(expected) - 200);
+    zassert_mem_equal(buf, expected, sizeof(expected));
+}
+
+// The decoder behind lv_img and lv_animimg, with rows read out of order
+ZTEST(rle_img, test_decoder) {
+    static const lv_coord_t rows[] = {0, 1, 2, 10, 9, 0, 20, 32, 31, 5};
+    static lv_color_t line[160];
+    lv_img_decoder_dsc_t dsc;
+
+    for (int i = 0; i < ARRAY_SIZE(assets); i++) {
+        const struct asset *asset = &assets[i];
+        const lv_img_dsc_t *img = asset->img;
+        const lv_color32_t *palette = (const lv_color32_t *)img->data;
+        uint32_t stride = STRIDE(img);
+
+        zassert_equal(lv_img_decoder_open(&dsc, img, lv_color_black(), 0), LV_RES_OK,
+                      "%s did not open", asset->name);
+        zassert_is_null(dsc.img_data, "%s decoded in one piece", asset->name);
+
+        for (int r = 0; r < ARRAY_SIZE(rows); r++) {
+            lv_coord_t y = rows[r];
+
+            if (y >= img->header.h) {
+                continue;
+            }
+
+            zassert_equal(lv_img_decoder_read_line(&dsc, 0, y, img->header.w, (uint8_t *)line),
+                          LV_RES_OK);
+            for (lv_coord_t x = 0; x < img->header.w; x++) {
+                uint8_t index = (asset->raw[y * stride + (x >> 3)] >> (7 - (x & 7))) & 1;
+                lv_color_t color = lv_color_make(palette[index].ch.red, palette[index].ch.green,
+                                                 palette[index].ch.blue);
+
+                zassert_equal(line[x].full, color.full, "%s: pixel (%d, %d) differs",
+                              asset->name, x, y);
+            }
+        }
+
+        lv_img_decoder_close(&dsc);
+    }
+}
+
+static void *rle_img_setup(void) {
+    rle_img_decoder_init();
+    return NULL;
+}
+
+ZTEST_SUITE(rle_img, NULL, rle_img_setup, NULL, NULL, NULL);
@@ -0,0 +1,6 @@
+#pragma once
+
+// The part of ZMK's header that widgets/util.h needs
+struct zmk_endpoint_instance {
+    int transport;
+};
@@ -0,0 +1,160 @@
+#include <lvgl.h>
+#include <lvgl_mem.h>
+#include <zephyr/ztest.h>
+
+#include "battery.h"
+#include "delta_anim.h"
+
+/*
+ * The smart battery animation of the peripheral screen over thousands of
+ * charging changes, as plugging and unplugging USB gives them: one image
+ * and one delta_anim_player for the whole run, and an LVGL heap that ends
+ * where it started.
+ */
+
+#define TOGGLES 5000
+#define DELETES 1000
+
+#ifndef SET_ANIMATION_SMART_BATTERY_OFF
+#define SET_ANIMATION_SMART_BATTERY_OFF 0
+#endif
+
+static uint8_t cbuf[CANVAS_BUF_SIZE(CANVAS_HEIGHT, CANVAS_WIDTH)];
+static lv_obj_t *canvas;
+
+// The player behind the animation image, found through the image source
+static struct delta_anim_player *find_player(void) {
+    lv_obj_t *parent = lv_obj_get_parent(canvas);
+
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(parent); i++) {
+        lv_obj_t *child = lv_obj_get_child(parent, i);
+
+        if (child != canvas && lv_obj_check_type(child, &lv_img_class)) {
+            return CONTAINER_OF(lv_img_get_src(child), struct delta_anim_player, img);
+        }
+    }
+
+    return NULL;
+}
+
+static uint32_t count_timers(void) {
+    uint32_t count = 0;
+
+    for (lv_timer_t *timer = lv_timer_get_next(NULL); timer; timer = lv_timer_get_next(timer)) {
+        count++;
+    }
+
+    return count;
+}
+
+static size_t heap_allocated(void) {
+    struct sys_memory_stats stats;
+
+    // Let LVGL render and free what it used for that first
+    lv_timer_handler();
+    lvgl_heap_stats(&stats);
+    return stats.allocated_bytes;
+}
+
+// Redraw the battery twice, as a level change and the state change would
+static void draw(bool charging, uint8_t level) {
+    struct status_state state = {.battery = level, .charging = charging};
+
+    draw_battery_status(canvas, &state);
+    draw_battery_status(canvas, &state);
+}
+
+ZTEST(smart_battery, test_toggle) {
+    // Create the image if no test did yet, and warm LVGL up
+    for (int i = 0; i < 4; i++) {
+        draw(i & 1, 50);
+        lv_timer_handler();
+    }
+
+    struct delta_anim_player *player = find_player();
+
+    zassert_not_null(player, "no animation image");
+
+    lv_obj_t *obj = player->obj;
+    uint32_t children = lv_obj_get_child_cnt(lv_obj_get_parent(canvas));
+    uint32_t timers = count_timers();
+    size_t allocated = heap_allocated();
+
+    for (int i = 0; i < TOGGLES; i++) {
+        bool charging = i & 1;
+
+        draw(charging, i % 101);
+        zassert_equal(player->running, charging, "toggle %d: running is %d", i, player->running);
+        if (!charging) {
+            zassert_equal(player->frame, SET_ANIMATION_SMART_BATTERY_OFF,
+                          "toggle %d: stopped on frame %u", i, player->frame);
+        }
+
+        if (i % 100 == 0) {
+            lv_timer_handler();
+        }
+    }
+
+    zassert_equal_ptr(find_player(), player, "the player moved");
+    zassert_equal_ptr(player->obj, obj, "the image was created again");
+    zassert_equal(lv_obj_get_child_cnt(lv_obj_get_parent(canvas)), children, "objects leaked");
+    zassert_equal(count_timers(), timers, "timers leaked");
+    zassert_equal(heap_allocated(), allocated, "LVGL heap grew");
+}
+
+// While charging the frames advance, while not they stay put
+ZTEST(smart_battery, test_playback) {
+    draw(true, 50);
+
+    struct delta_anim_player *player = find_player();
+
+    zassert_not_null(player);
+
+    uint32_t period = player->period;
+    uint16_t frame = player->frame;
+
+    k_msleep(3 * period);
+    lv_timer_handler();
+    zassert_not_equal(player->frame, frame, "no frame played while charging");
+
+    draw(false, 50);
+    frame = player->frame;
+    k_msleep(3 * period);
+    lv_timer_handler();
+    zassert_equal(player->frame, frame, "frames played while not charging");
+}
+
+// Deleting the image, e.g. with the screen, lets the next draw start over
+ZTEST(smart_battery, test_delete) {
+    draw(false, 50);
+
+    size_t allocated = heap_allocated();
+    uint32_t timers = count_timers();
+
+    for (int i = 0; i < DELETES; i++) {
+        struct delta_anim_player *player = find_player();
+
+        zassert_not_null(player, "cycle %d: no animation image", i);
+        lv_obj_del(player->obj);
+        zassert_is_null(player->obj);
+        zassert_is_null(player->timer);
+
+        draw(i & 1, 50);
+        zassert_not_null(find_player(), "cycle %d: not created again", i);
+        draw(false, 50);
+    }
+
+    zassert_equal(count_timers(), timers, "timers leaked");
+    zassert_equal(heap_allocated(), allocated, "LVGL heap grew");
+}
+
+static void *smart_battery_setup(void) {
+    canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, cbuf, CANVAS_HEIGHT, CANVAS_WIDTH, LV_IMG_CF_INDEXED_1BIT);
+    lv_canvas_set_palette(canvas, 0, LVGL_BACKGROUND);
+    lv_canvas_set_palette(canvas, 1, LVGL_FOREGROUND);
+
+    return NULL;
+}
+
+ZTEST_SUITE(smart_battery, NULL, smart_battery_setup, NULL, NULL, NULL);